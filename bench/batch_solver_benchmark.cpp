@@ -0,0 +1,70 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/batch_solver.hpp>
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+	auto english_graph() -> word_ladder::word_graph const& {
+		static auto const graph = word_ladder::word_graph(word_ladder::load_lexicon("english.txt"));
+		return graph;
+	}
+
+	// The same few thousand pairs of four- and five-letter words on every run
+	auto english_queries() -> std::vector<std::pair<std::string, std::string>> const& {
+		static auto const queries = [] {
+			auto const english = word_ladder::load_lexicon("english.txt");
+			auto engine = std::mt19937(6771);
+			auto result = std::vector<std::pair<std::string, std::string>>{};
+			for (auto const length : {std::size_t{4}, std::size_t{5}}) {
+				auto const& words = english.words_of_length(length);
+				auto sorted = std::vector<std::string>(words.begin(), words.end());
+				std::sort(sorted.begin(), sorted.end());
+				auto pick = std::uniform_int_distribution<std::size_t>(0, sorted.size() - 1);
+				std::generate_n(std::back_inserter(result), 1000, [&] {
+					return std::pair(sorted[pick(engine)], sorted[pick(engine)]);
+				});
+			}
+			return result;
+		}();
+		return queries;
+	}
+
+	// Solves the whole batch once per iteration on state.range(0) threads
+	void batch_solver_scaling(benchmark::State& state) {
+		auto const& queries = english_queries();
+		auto solver =
+		   word_ladder::batch_solver(english_graph(), static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(solver.solve(queries));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+	}
+
+	// One run for each thread count from 1 up to the number of hardware threads
+	void each_thread_count(benchmark::internal::Benchmark* benchmark) {
+		auto const threads = std::max(std::thread::hardware_concurrency(), 1U);
+		for (auto count = 1U; count <= threads; ++count) {
+			benchmark->Arg(count);
+		}
+	}
+} // namespace
+
+BENCHMARK(batch_solver_scaling)
+   ->Apply(each_thread_count)
+   ->ArgName("threads")
+   ->UseRealTime()
+   ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,81 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+	// A random quarter of every seven-letter word over eight letters: about half a million words
+	// whose search frontiers grow to tens of thousands of words
+	struct synthetic {
+		word_ladder::word_graph graph;
+		std::vector<std::pair<std::string, std::string>> queries;
+	};
+
+	auto synthetic_lexicon() -> synthetic const& {
+		static auto const built = [] {
+			auto engine = std::mt19937(6771);
+			auto coin = std::bernoulli_distribution(0.25);
+			auto lexicon = std::unordered_set<std::string>{};
+			auto word = std::string(7, 'a');
+			for (auto code = 0; code < 8 * 8 * 8 * 8 * 8 * 8 * 8; ++code) {
+				auto rest = code;
+				for (auto& letter : word) {
+					letter = static_cast<char>('a' + rest % 8);
+					rest /= 8;
+				}
+				if (coin(engine)) {
+					lexicon.insert(word);
+				}
+			}
+
+			auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+			std::sort(words.begin(), words.end());
+			auto pick = std::uniform_int_distribution<std::size_t>(0, words.size() - 1);
+			auto queries = std::vector<std::pair<std::string, std::string>>{};
+			std::generate_n(std::back_inserter(queries), 8, [&] {
+				return std::pair(words[pick(engine)], words[pick(engine)]);
+			});
+			return synthetic{word_ladder::word_graph(lexicon), std::move(queries)};
+		}();
+		return built;
+	}
+
+	// Runs the same few large queries on state.range(0) threads
+	void parallel_search_scaling(benchmark::State& state) {
+		auto const& [graph, queries] = synthetic_lexicon();
+		auto const threads = static_cast<std::size_t>(state.range(0));
+		for (auto _ : state) {
+			for (auto const& [from, to] : queries) {
+				benchmark::DoNotOptimize(word_ladder::generate_parallel(from, to, graph, threads));
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+	}
+
+	void each_thread_count(benchmark::internal::Benchmark* benchmark) {
+		auto const threads = std::max(std::thread::hardware_concurrency(), 1U);
+		for (auto count = 1U; count <= threads; ++count) {
+			benchmark->Arg(count);
+		}
+	}
+} // namespace
+
+BENCHMARK(parallel_search_scaling)
+   ->Apply(each_thread_count)
+   ->ArgName("threads")
+   ->UseRealTime()
+   ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,357 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/packed_lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+#include <comp6771/word_rows.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+// Every allocation in the process goes through these, so each benchmark can report how many
+// allocations an operation makes
+namespace {
+	auto allocations = std::atomic<std::uint64_t>{0};
+
+	auto counted_allocate(std::size_t size) -> void* {
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		if (auto* const p = std::malloc(size == 0 ? 1 : size)) {
+			return p;
+		}
+		throw std::bad_alloc();
+	}
+
+	// Over-aligned blocks, which is how std::pmr::new_delete_resource() gets every block an arena
+	// asks for
+	auto counted_allocate(std::size_t size, std::align_val_t alignment) -> void* {
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		auto const align = static_cast<std::size_t>(alignment);
+		// aligned_alloc wants a size that is a multiple of the alignment
+		auto const rounded = (std::max(size, std::size_t{1}) + align - 1) / align * align;
+		if (auto* const p = std::aligned_alloc(align, rounded)) {
+			return p;
+		}
+		throw std::bad_alloc();
+	}
+} // namespace
+
+auto operator new(std::size_t size) -> void* {
+	return counted_allocate(size);
+}
+
+auto operator new[](std::size_t size) -> void* {
+	return counted_allocate(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+	return counted_allocate(size, alignment);
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+	return counted_allocate(size, alignment);
+}
+
+auto operator delete(void* p) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete(void* p, std::size_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p, std::size_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete(void* p, std::align_val_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete(void* p, std::size_t, std::align_val_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p, std::align_val_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p, std::size_t, std::align_val_t) noexcept -> void {
+	std::free(p);
+}
+
+namespace {
+	auto english_set() -> std::unordered_set<std::string> const& {
+		static auto const words = word_ladder::read_lexicon("english.txt");
+		return words;
+	}
+
+	auto english_lexicon() -> word_ladder::lexicon const& {
+		static auto const words = word_ladder::load_lexicon("english.txt");
+		return words;
+	}
+
+	auto english_index() -> word_ladder::neighbor_index const& {
+		static auto const index = word_ladder::neighbor_index(english_lexicon());
+		return index;
+	}
+
+	auto english_rows() -> word_ladder::word_rows const& {
+		static auto const rows = word_ladder::word_rows(english_lexicon());
+		return rows;
+	}
+
+	auto english_packed() -> word_ladder::packed_lexicon const& {
+		static auto const words = word_ladder::packed_lexicon(english_lexicon());
+		return words;
+	}
+
+	auto english_graph() -> word_ladder::word_graph const& {
+		static auto const graph = word_ladder::word_graph(english_lexicon());
+		return graph;
+	}
+
+	// Reports the allocations made since `before` as a per-iteration average
+	auto count_allocations(benchmark::State& state, std::uint64_t before) -> void {
+		auto const made = allocations.load(std::memory_order_relaxed) - before;
+		state.counters["allocs"] = benchmark::Counter(static_cast<double>(made),
+		                                              benchmark::Counter::kAvgIterations);
+	}
+
+	void load_lexicon_set(benchmark::State& state) {
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(word_ladder::read_lexicon("english.txt"));
+		}
+		count_allocations(state, before);
+	}
+
+	void load_lexicon_partitioned(benchmark::State& state) {
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(word_ladder::load_lexicon("english.txt"));
+		}
+		count_allocations(state, before);
+	}
+
+	void build_word_graph(benchmark::State& state) {
+		auto const& words = english_lexicon();
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(word_ladder::word_graph(words));
+		}
+		count_allocations(state, before);
+	}
+
+	// The same spread of up to 256 words of `length` on every run
+	auto sample(std::size_t length) -> std::vector<std::string> {
+		auto const& words = english_lexicon().words_of_length(length);
+		auto sorted = std::vector<std::string>(words.begin(), words.end());
+		std::sort(sorted.begin(), sorted.end());
+		auto result = std::vector<std::string>{};
+		auto const step = std::max(sorted.size() / 256, std::size_t{1});
+		for (auto i = std::size_t{0}; i < sorted.size(); i += step) {
+			result.push_back(sorted[i]);
+		}
+		return result;
+	}
+
+	// Finds the neighbours of each sampled word of length state.range(0) the way generate() over a
+	// lexicon does: every letter at every position, each probed in a hash set
+	void hash_probe(benchmark::State& state) {
+		auto const length = static_cast<std::size_t>(state.range(0));
+		auto const& words = english_lexicon().words_of_length(length);
+		auto const letters = english_lexicon().letters_of_length(length);
+		auto const queries = sample(length);
+		auto found = std::uint64_t{0};
+		for (auto _ : state) {
+			found = 0;
+			for (auto word : queries) {
+				for (auto& c : word) {
+					auto const original = c;
+					for (auto const letter : letters) {
+						if (letter == original) {
+							continue;
+						}
+						c = letter;
+						found += words.contains(std::string_view(word)) ? 1U : 0U;
+					}
+					c = original;
+				}
+			}
+			benchmark::DoNotOptimize(found);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+		state.counters["words"] = static_cast<double>(words.size());
+		state.counters["neighbours"] = static_cast<double>(found);
+	}
+
+	// The same, by asking the neighbour engine that `words` returns for each sampled word's
+	// neighbours
+	template<typename Words>
+	void neighbor_scan(benchmark::State& state, Words const& (*words)()) {
+		auto const length = static_cast<std::size_t>(state.range(0));
+		auto const& engine = words();
+		auto const queries = sample(length);
+		auto found = std::uint64_t{0};
+		for (auto _ : state) {
+			found = 0;
+			for (auto const& word : queries) {
+				engine.for_each_neighbor(word, [&found](std::string_view) { ++found; });
+			}
+			benchmark::DoNotOptimize(found);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+		state.counters["words"] = static_cast<double>(engine.word_count(length));
+		state.counters["neighbours"] = static_cast<double>(found);
+	}
+
+	// Runs one query against the lexicon representation that `words` returns, reporting how many
+	// ladders it found alongside its time and allocations. Engines that can report search_stats
+	// also report how many words the query expanded and how many hash probes it made, taken from
+	// one extra run outside the timed loop.
+	template<typename Words>
+	void query(benchmark::State& state, Words const& (*words)(), char const* from, char const* to) {
+		auto const& lexicon = words();
+		auto const source = std::string(from);
+		auto const target = std::string(to);
+		auto ladders = std::size_t{0};
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			auto const result = word_ladder::generate(source, target, lexicon);
+			ladders = result.size();
+			benchmark::DoNotOptimize(result);
+		}
+		count_allocations(state, before);
+		state.counters["ladders"] = static_cast<double>(ladders);
+
+		if constexpr (!std::is_same_v<Words, word_ladder::word_graph>) {
+			auto stats = word_ladder::search_stats{};
+			benchmark::DoNotOptimize(word_ladder::generate(source, target, lexicon, nullptr, &stats));
+			state.counters["expanded"] = static_cast<double>(stats.dequeued);
+			state.counters["probes"] = static_cast<double>(stats.probes);
+		}
+	}
+
+	// Walks every word the index can reach from `from`, breadth first. `mark(id, word)` must
+	// record that the walk reached `word` and return whether it had not reached it before.
+	template<typename Mark>
+	auto reach_all(std::string_view from,
+	               std::vector<std::string_view>& front,
+	               std::vector<std::string_view>& next,
+	               Mark const& mark) -> void {
+		auto const& index = english_index();
+		front.assign({from});
+		while (!front.empty()) {
+			next.clear();
+			std::for_each(front.begin(), front.end(), [&](std::string_view word) {
+				index.for_each_neighbor_id(word, [&](std::uint32_t id, std::string_view step) {
+					if (mark(id, step)) {
+						next.push_back(step);
+					}
+				});
+			});
+			front.swap(next);
+		}
+	}
+
+	// Keeps the words a walk reached in a hash set from an arena, as the index search once did
+	void visited_set(benchmark::State& state, char const* from) {
+		auto front = std::vector<std::string_view>{};
+		auto next = std::vector<std::string_view>{};
+		auto reached = std::size_t{0};
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			auto arena = std::pmr::monotonic_buffer_resource();
+			auto visited = std::pmr::unordered_set<std::string_view>({from}, 0, &arena);
+			reach_all(from, front, next, [&visited](std::uint32_t, std::string_view word) {
+				return visited.insert(word).second;
+			});
+			reached = visited.size();
+		}
+		count_allocations(state, before);
+		state.counters["reached"] = static_cast<double>(reached);
+	}
+
+	// Marks the words a walk reached by id with a stamp that is new for each walk, in one array
+	// that every walk reuses, as the index search does now
+	void visited_stamps(benchmark::State& state, char const* from) {
+		auto const& index = english_index();
+		auto front = std::vector<std::string_view>{};
+		auto next = std::vector<std::string_view>{};
+		auto stamps = std::vector<std::uint32_t>(index.word_count(std::string_view(from).size()));
+		auto stamp = std::uint32_t{0};
+		auto reached = std::size_t{0};
+		auto const before = allocations.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			++stamp;
+			stamps[*index.find(from)] = stamp;
+			reached = 1;
+			reach_all(from, front, next, [&](std::uint32_t id, std::string_view) {
+				if (stamps[id] == stamp) {
+					return false;
+				}
+				stamps[id] = stamp;
+				++reached;
+				return true;
+			});
+		}
+		count_allocations(state, before);
+		state.counters["reached"] = static_cast<double>(reached);
+	}
+} // namespace
+
+BENCHMARK(load_lexicon_set)->Unit(benchmark::kMillisecond);
+BENCHMARK(load_lexicon_partitioned)->Unit(benchmark::kMillisecond);
+BENCHMARK(build_word_graph)->Unit(benchmark::kMillisecond);
+
+// Finding the neighbours of words of each length: probing a hash set, scanning rows, and
+// reading the index's buckets
+BENCHMARK(hash_probe)->DenseRange(2, 12)->ArgName("length");
+BENCHMARK_CAPTURE(neighbor_scan, rows, english_rows)->DenseRange(2, 12)->ArgName("length");
+BENCHMARK_CAPTURE(neighbor_scan, index, english_index)->DenseRange(2, 12)->ArgName("length");
+
+// A short query, a long one with many ladders, and one that fails, on each engine
+BENCHMARK_CAPTURE(query, set_short, english_set, "awake", "sleep");
+BENCHMARK_CAPTURE(query, set_many_paths, english_set, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, set_failing, english_set, "airplane", "tricycle");
+BENCHMARK_CAPTURE(query, lexicon_short, english_lexicon, "awake", "sleep");
+BENCHMARK_CAPTURE(query, lexicon_many_paths, english_lexicon, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, lexicon_failing, english_lexicon, "airplane", "tricycle");
+BENCHMARK_CAPTURE(query, packed_short, english_packed, "awake", "sleep");
+BENCHMARK_CAPTURE(query, packed_many_paths, english_packed, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, packed_failing, english_packed, "airplane", "tricycle");
+BENCHMARK_CAPTURE(query, index_short, english_index, "awake", "sleep");
+BENCHMARK_CAPTURE(query, index_many_paths, english_index, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, index_failing, english_index, "airplane", "tricycle");
+BENCHMARK_CAPTURE(query, rows_short, english_rows, "awake", "sleep");
+BENCHMARK_CAPTURE(query, rows_many_paths, english_rows, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, rows_failing, english_rows, "airplane", "tricycle");
+BENCHMARK_CAPTURE(query, graph_short, english_graph, "awake", "sleep");
+BENCHMARK_CAPTURE(query, graph_many_paths, english_graph, "atlases", "cabaret");
+BENCHMARK_CAPTURE(query, graph_failing, english_graph, "airplane", "tricycle");
+
+// Keeping the words a search has reached: a hash set against an array of stamps, over every word
+// reachable from a five-letter and a seven-letter word
+BENCHMARK_CAPTURE(visited_set, five_letters, "awake");
+BENCHMARK_CAPTURE(visited_set, seven_letters, "atlases");
+BENCHMARK_CAPTURE(visited_stamps, five_letters, "awake");
+BENCHMARK_CAPTURE(visited_stamps, seven_letters, "atlases");
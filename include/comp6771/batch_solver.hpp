@@ -0,0 +1,80 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_BATCH_SOLVER_HPP
+#define COMP6771_BATCH_SOLVER_HPP
+
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// Solves batches of independent queries against one word_graph on a pool of worker threads.
+	//
+	// A batch starts out split into one contiguous run of queries per worker. A worker takes
+	// queries from the front of its own run. Once that run is empty, it steals the back half of
+	// another worker's run, so a few slow queries do not leave the other threads idle. Each worker
+	// keeps its own ladder_range, whose search buffers are reused from query to query, so threads
+	// do not compete for the allocator to set up each search. Every query's ladders are written to
+	// that query's slot in the result, so the result does not depend on which thread solved what.
+	class batch_solver {
+	public:
+		// Starts `threads` workers (at least one). The graph must outlive the solver.
+		explicit batch_solver(word_graph const& graph,
+		                      std::size_t threads = std::thread::hardware_concurrency());
+		batch_solver(batch_solver const&) = delete;
+		auto operator=(batch_solver const&) -> batch_solver& = delete;
+		~batch_solver();
+
+		[[nodiscard]] auto thread_count() const -> std::size_t;
+
+		// Returns each query's ladders, as generate() would, in the order the queries were given.
+		// Batches from different threads are solved one after another. If solving a query throws,
+		// the first such exception is rethrown once the batch has stopped.
+		[[nodiscard]] auto solve(std::span<std::pair<std::string, std::string> const> queries)
+		   -> std::vector<std::vector<std::vector<std::string>>>;
+
+	private:
+		// The queries [begin, end) of the current batch that a worker has yet to start
+		struct work_queue {
+			std::mutex lock;
+			std::size_t begin = 0;
+			std::size_t end = 0;
+		};
+
+		auto run(std::size_t worker) -> void;
+		auto work(std::size_t worker) -> void;
+		auto take(std::size_t worker) -> std::optional<std::size_t>;
+		auto steal(std::size_t thief) -> bool;
+
+		word_graph const* graph_;
+		std::vector<std::unique_ptr<work_queue>> queues_;
+		std::vector<ladder_range> scratch_;
+		std::vector<std::thread> workers_;
+
+		std::mutex solving_;
+		std::mutex lock_;
+		std::condition_variable start_;
+		std::condition_variable finished_;
+		std::span<std::pair<std::string, std::string> const> queries_;
+		std::vector<std::vector<std::vector<std::string>>>* results_ = nullptr;
+		std::uint64_t batch_ = 0;
+		std::size_t busy_ = 0;
+		bool stopping_ = false;
+		std::exception_ptr error_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_BATCH_SOLVER_HPP
@@ -0,0 +1,121 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_CACHE_ENTRIES_HPP
+#define COMP6771_CACHE_ENTRIES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace word_ladder {
+	// Hit and miss counts for a cache, and how much it holds
+	struct cache_stats {
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+		std::size_t entries = 0;
+		std::size_t bytes = 0;
+	};
+
+	namespace detail {
+		// The entries of a bounded cache, which every cache keeps the same way. Values are kept in a
+		// list, most recently used first, and looked up by key. Once they take up more than the
+		// byte budget, the least recently used are evicted; a value bigger than the whole budget is
+		// not kept at all. Each member takes the lock, so a cache can do its own work (a search)
+		// between calls without holding it.
+		template<typename Key, typename Value, typename Hash = std::hash<Key>>
+		class cache_entries {
+		public:
+			explicit cache_entries(std::size_t budget_bytes)
+			: budget_(budget_bytes) {}
+
+			// Returns the value kept under `key` and makes it the most recently used, or returns
+			// std::nullopt. Either way, counts a hit or a miss.
+			[[nodiscard]] auto find(Key const& key) -> std::optional<Value> {
+				auto const guard = std::scoped_lock(lock_);
+				auto const found = by_key_.find(std::cref(key));
+				if (found == by_key_.end()) {
+					++stats_.misses;
+					return std::nullopt;
+				}
+				++stats_.hits;
+				entries_.splice(entries_.begin(), entries_, found->second);
+				return found->second->value;
+			}
+
+			// Keeps `value` under `key`, evicting as needed, unless it is bigger than the whole budget
+			// or a value is already kept under `key`. `bytes` is what the key and value hold beyond
+			// their own size.
+			auto insert(Key key, Value value, std::size_t bytes) -> void {
+				bytes += sizeof(entry) + sizeof(typename index::value_type);
+				auto const guard = std::scoped_lock(lock_);
+				if (bytes <= budget_ and !by_key_.contains(std::cref(key))) {
+					while (stats_.bytes + bytes > budget_) {
+						auto const& oldest = entries_.back();
+						stats_.bytes -= oldest.bytes;
+						by_key_.erase(std::cref(oldest.key));
+						entries_.pop_back();
+						++stats_.evictions;
+					}
+					entries_.push_front(entry{std::move(key), std::move(value), bytes});
+					by_key_.emplace(std::cref(entries_.front().key), entries_.begin());
+					stats_.bytes += bytes;
+				}
+				stats_.entries = entries_.size();
+			}
+
+			[[nodiscard]] auto stats() const -> cache_stats {
+				auto const guard = std::scoped_lock(lock_);
+				return stats_;
+			}
+
+			auto clear() -> void {
+				auto const guard = std::scoped_lock(lock_);
+				by_key_.clear();
+				entries_.clear();
+				stats_.entries = 0;
+				stats_.bytes = 0;
+			}
+
+		private:
+			struct entry {
+				Key key;
+				Value value;
+				std::size_t bytes = 0;
+			};
+
+			// The index refers to the keys in the entries, so each key is stored once
+			using key_ref = std::reference_wrapper<Key const>;
+
+			struct key_hash {
+				[[nodiscard]] auto operator()(key_ref key) const -> std::size_t {
+					return Hash{}(key.get());
+				}
+			};
+
+			struct key_equal {
+				[[nodiscard]] auto operator()(key_ref x, key_ref y) const -> bool {
+					return x.get() == y.get();
+				}
+			};
+
+			using index =
+			   std::unordered_map<key_ref, typename std::list<entry>::iterator, key_hash, key_equal>;
+
+			std::size_t budget_;
+			mutable std::mutex lock_;
+			// Most recently used first
+			std::list<entry> entries_;
+			index by_key_;
+			cache_stats stats_;
+		};
+	} // namespace detail
+} // namespace word_ladder
+
+#endif // COMP6771_CACHE_ENTRIES_HPP
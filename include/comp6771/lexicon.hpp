@@ -0,0 +1,75 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_LEXICON_HPP
+#define COMP6771_LEXICON_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// A lexicon whose words are split into one set per word length when it is loaded, so a query
+	// can go straight to the words of its own length without filtering or copying anything. The
+	// sets hold views into text owned by the lexicon (a buffer or a file mapping).
+	//
+	// A lexicon is an immutable, reference-counted handle. Copying one copies a pointer, not the
+	// words, and nothing can change the words once they are loaded. Any number of threads may
+	// therefore query the same lexicon, or their own copies of it, at once without locking.
+	class lexicon {
+	public:
+		lexicon() = default;
+		explicit lexicon(std::unordered_set<std::string> const& words);
+
+		[[nodiscard]] auto size() const -> std::size_t;
+		[[nodiscard]] auto max_length() const -> std::size_t;
+		[[nodiscard]] auto contains(std::string_view word) const -> bool;
+
+		// Returns a value that a lexicon shares with its copies and with no separately loaded
+		// lexicon, for as long as any of those copies exists
+		[[nodiscard]] auto identity() const -> void const*;
+
+		// Returns every word of `length`. The set is empty if there are none.
+		[[nodiscard]] auto words_of_length(std::size_t length) const
+		   -> std::unordered_set<std::string_view> const&;
+
+		// Returns every letter used by a word of `length`, sorted and without duplicates.
+		[[nodiscard]] auto letters_of_length(std::size_t length) const -> std::string_view;
+
+	private:
+		friend auto load_lexicon(std::string const& path) -> lexicon;
+		friend auto map_lexicon(std::string const& path) -> lexicon;
+
+		struct partition {
+			std::unordered_set<std::string_view> words;
+			std::string letters;
+		};
+
+		// Everything a lexicon holds, shared by all its copies
+		struct contents {
+			std::shared_ptr<void const> storage;
+			std::vector<partition> partitions;
+			std::size_t size = 0;
+		};
+
+		// Indexes the words of `text`, which `storage` keeps alive
+		lexicon(std::shared_ptr<void const> storage, std::string_view text);
+
+		std::shared_ptr<contents const> words_;
+	};
+
+	// Reads a whitespace-separated word list into a length-partitioned lexicon. The whole file is
+	// read in one go and every word is a view into it.
+	[[nodiscard]] auto load_lexicon(std::string const& path) -> lexicon;
+
+	// As load_lexicon(), but maps the file read-only instead of reading it. Every word is a view
+	// into the mapping, which stays mapped while any copy of the lexicon exists, so processes that
+	// map the same file share its pages through the page cache. Falls back to load_lexicon() where
+	// mmap is unavailable.
+	[[nodiscard]] auto map_lexicon(std::string const& path) -> lexicon;
+} // namespace word_ladder
+
+#endif // COMP6771_LEXICON_HPP
@@ -0,0 +1,24 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_MAPPED_FILE_HPP
+#define COMP6771_MAPPED_FILE_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace word_ladder {
+	// The whole contents of a file, mapped read-only. `contents` stays valid for as long as any copy
+	// of `storage` is alive.
+	struct mapped_file {
+		std::shared_ptr<void const> storage;
+		std::string_view contents;
+	};
+
+	// Maps `path` into memory read-only. Where mmap is unavailable the file is read into a buffer
+	// instead, which `storage` then owns.
+	[[nodiscard]] auto map_file(std::string const& path) -> mapped_file;
+} // namespace word_ladder
+
+#endif // COMP6771_MAPPED_FILE_HPP
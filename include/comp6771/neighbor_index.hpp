@@ -0,0 +1,132 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_NEIGHBOR_INDEX_HPP
+#define COMP6771_NEIGHBOR_INDEX_HPP
+
+#include <comp6771/lexicon.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	class word_graph;
+
+	// Groups every word of a lexicon into wildcard buckets: a word of length n belongs to the n
+	// buckets made by replacing one of its letters with '*' ("cat" is in "*at", "c*t" and "ca*").
+	// Two words are a step apart exactly when they share a bucket, so the neighbours of a word are
+	// found by scanning its buckets rather than probing a hash set with 26 * n candidate strings.
+	//
+	// The index is immutable once built and may be shared by any number of queries.
+	class neighbor_index {
+	public:
+		neighbor_index() = default;
+		explicit neighbor_index(std::unordered_set<std::string> const& lexicon);
+		explicit neighbor_index(lexicon const& words);
+
+		[[nodiscard]] auto contains(std::string_view word) const -> bool;
+
+		// Returns the words matching `pattern` in sorted order. `pattern` must contain exactly one
+		// '*', which matches any letter.
+		[[nodiscard]] auto bucket(std::string_view pattern) const -> std::vector<std::string_view>;
+
+		// Returns how many words of `length` the index holds. Their ids run from 0 to one less than
+		// this, in sorted order.
+		[[nodiscard]] auto word_count(std::size_t length) const -> std::size_t;
+
+		// Returns the id of `word` among the words of its length, or std::nullopt if it is not in
+		// the index
+		[[nodiscard]] auto find(std::string_view word) const -> std::optional<std::uint32_t>;
+
+		// Returns a label shared by every word of `length` that the word with id `id` has a ladder
+		// to, and no other word. The index finds the connected components of each length with
+		// union-find over its buckets when it is built.
+		[[nodiscard]] auto component(std::size_t length, std::uint32_t id) const -> std::uint32_t;
+
+		// Returns whether there is any ladder between the words of `length` with ids `from` and
+		// `to`, in constant time
+		[[nodiscard]] auto connected(std::size_t length, std::uint32_t from, std::uint32_t to) const
+		   -> bool;
+
+		// Calls `f` with every word in the index that differs from `word` in exactly one letter.
+		// `word` need not be in the index itself.
+		template<typename F>
+		auto for_each_neighbor(std::string_view word, F&& f) const -> void {
+			for_each_neighbor_id(word, [&f](std::uint32_t, std::string_view next) { f(next); });
+		}
+
+		// As for_each_neighbor(), but calls `f(id, word)` with each word's id as well
+		template<typename F>
+		auto for_each_neighbor_id(std::string_view word, F&& f) const -> void {
+			if (auto const* const part = find_partition(word.size()); part != nullptr) {
+				part->for_each_neighbor(word, [part, &f](auto id) { f(id, part->word(id)); });
+			}
+		}
+
+	private:
+		friend class word_graph;
+
+		// All words of one length, stored back to back in sorted order. A word's id is its position
+		// in that order.
+		struct partition {
+			std::size_t length = 0;
+			std::string words;
+			// The following hold `length` rows of size() entries each, one row per letter position p.
+			// order: word ids sorted by the word with letter p masked out, so each bucket is a run.
+			// bucket_begin: for each entry of `order`, where its run starts.
+			// rank: for each word id, its entry in `order`.
+			std::vector<std::uint32_t> order;
+			std::vector<std::uint32_t> bucket_begin;
+			std::vector<std::uint32_t> rank;
+			// For each word id, the smallest id in its connected component
+			std::vector<std::uint32_t> components;
+
+			[[nodiscard]] auto size() const -> std::size_t;
+			[[nodiscard]] auto word(std::size_t id) const -> std::string_view;
+			[[nodiscard]] auto find(std::string_view word) const -> std::optional<std::uint32_t>;
+			[[nodiscard]] auto equal_range(std::string_view pattern, std::size_t p) const
+			   -> std::pair<std::size_t, std::size_t>;
+
+			// Calls `f` with the id of every word one letter away from `word`
+			template<typename F>
+			auto for_each_neighbor(std::string_view word, F&& f) const -> void {
+				auto const n = size();
+				auto const id = find(word);
+				for (auto p = std::size_t{0}; p < length; ++p) {
+					auto const* const row = order.data() + p * n;
+					auto const* const starts = bucket_begin.data() + p * n;
+					auto first = std::size_t{0};
+					auto last = std::size_t{0};
+					if (id) {
+						first = starts[rank[p * n + *id]];
+						for (last = first; last < n and starts[last] == first; ++last) {}
+					}
+					else {
+						std::tie(first, last) = equal_range(word, p);
+					}
+
+					for (auto k = first; k < last; ++k) {
+						if (row[k] != id) {
+							f(row[k]);
+						}
+					}
+				}
+			}
+		};
+
+		// Fills `partitions_` from lists of words grouped by length. Sorts each list in place.
+		auto build(std::vector<std::vector<std::string_view>>& by_length) -> void;
+
+		[[nodiscard]] auto find_partition(std::size_t length) const -> partition const*;
+
+		std::vector<partition> partitions_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_NEIGHBOR_INDEX_HPP
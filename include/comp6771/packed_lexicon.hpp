@@ -0,0 +1,111 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_PACKED_LEXICON_HPP
+#define COMP6771_PACKED_LEXICON_HPP
+
+#include <comp6771/lexicon.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// A lexicon whose short words are packed into 64-bit keys, five bits to a letter: 'a' is 1 and
+	// 'z' is 26, and the ith letter sits in bits [5i, 5i + 5). A word of up to twelve letters fits
+	// in 60 bits, and since no letter is 0, the key 0 never stands for a word. The words of each
+	// length are kept in a flat open-addressing table of keys, so checking a word is a multiply,
+	// a shift and a short run of integer compares. A neighbour of a key differs from it in one
+	// five-bit field, so it is made with a single XOR, with no string built.
+	//
+	// A length is packed only if every word of that length is made of the letters a to z. Words
+	// of other lengths are only in words(), the lexicon the packed one was built from. The packed
+	// lexicon is immutable once built and may be shared by any number of queries.
+	class packed_lexicon {
+	public:
+		using key = std::uint64_t;
+
+		static constexpr auto max_length = std::size_t{12};
+
+		packed_lexicon() = default;
+		explicit packed_lexicon(std::unordered_set<std::string> const& words);
+		explicit packed_lexicon(lexicon words);
+
+		// Returns the key for `word`, or std::nullopt if it is empty, longer than max_length or has
+		// a character other than a to z
+		[[nodiscard]] static auto pack(std::string_view word) -> std::optional<key>;
+		[[nodiscard]] static auto unpack(key k) -> std::string;
+
+		[[nodiscard]] auto words() const -> lexicon const&;
+
+		// Returns whether the words of `length` are held as keys
+		[[nodiscard]] auto packed(std::size_t length) const -> bool;
+
+		// Returns how many different letters the words of a packed `length` use
+		[[nodiscard]] auto letter_count(std::size_t length) const -> std::size_t;
+
+		// Pre: packed(length)
+		[[nodiscard]] auto contains(key k, std::size_t length) const -> bool {
+			return partitions_[length].contains(k);
+		}
+
+		// Calls `f` with the key of every word that differs from the word of `length` letters
+		// that `k` stands for in exactly one letter. That word need not be in the lexicon.
+		// Pre: packed(length)
+		template<typename F>
+		auto for_each_neighbor(key k, std::size_t length, F&& f) const -> void {
+			auto const& part = partitions_[length];
+			for (auto shift = 0U; shift < 5 * length; shift += 5) {
+				auto const original = (k >> shift) & key{31};
+				for (auto letters = part.letters; letters != 0; letters &= letters - 1) {
+					auto const letter = static_cast<key>(std::countr_zero(letters));
+					if (letter == original) {
+						continue;
+					}
+					if (auto const next = k ^ ((original ^ letter) << shift); part.contains(next)) {
+						f(next);
+					}
+				}
+			}
+		}
+
+	private:
+		// Every word of one length
+		struct partition {
+			// A power of two long, with 0 in each empty slot
+			std::vector<key> slots;
+			// Keys are placed by their top bits after a multiply: 64 - log2(slots.size())
+			unsigned shift = 64;
+			// Bit c is set if a word of this length has the letter with code c
+			std::uint32_t letters = 0;
+			bool packed = false;
+
+			[[nodiscard]] auto slot(key k) const -> std::size_t {
+				return static_cast<std::size_t>((k * 0x9E3779B97F4A7C15U) >> shift);
+			}
+
+			[[nodiscard]] auto contains(key k) const -> bool {
+				auto const mask = slots.size() - 1;
+				for (auto i = slot(k);; i = (i + 1) & mask) {
+					if (slots[i] == k) {
+						return true;
+					}
+					if (slots[i] == 0) {
+						return false;
+					}
+				}
+			}
+		};
+
+		lexicon words_;
+		// Indexed by word length, up to max_length
+		std::vector<partition> partitions_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_PACKED_LEXICON_HPP
@@ -0,0 +1,58 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_RESULT_CACHE_HPP
+#define COMP6771_RESULT_CACHE_HPP
+
+#include <comp6771/cache_entries.hpp>
+#include <comp6771/lexicon.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace word_ladder {
+	// A bounded cache of whole results in front of generate(), keyed by the lexicon and the pair of
+	// words. Ladders are symmetric, so a query and its reverse share one entry: the reverse's
+	// ladders are read back reversed and re-sorted. When the entries take up more than the byte
+	// budget, the least recently used are evicted. A query with a word that is not in the
+	// lexicon is passed straight through. Each entry keeps its lexicon alive, so an identity is
+	// never reused while it is still in the cache. It may be used from several threads at once.
+	class result_cache {
+	public:
+		explicit result_cache(std::size_t budget_bytes);
+
+		// Returns what generate(from, to, words) would
+		[[nodiscard]] auto generate(std::string const& from, std::string const& to, lexicon const& words)
+		   -> std::vector<std::vector<std::string>>;
+
+		[[nodiscard]] auto stats() const -> cache_stats;
+		auto clear() -> void;
+
+	private:
+		// A query with its words in sorted order
+		struct key {
+			void const* lexicon;
+			std::string first;
+			std::string second;
+
+			[[nodiscard]] auto operator==(key const&) const -> bool = default;
+		};
+
+		struct key_hash {
+			[[nodiscard]] auto operator()(key const& k) const -> std::size_t;
+		};
+
+		struct result {
+			lexicon words;
+			// From `key::first` to `key::second`. Shared, so a hit copies a pointer under the lock
+			// and the ladders themselves after it is released.
+			std::shared_ptr<std::vector<std::vector<std::string>> const> ladders;
+		};
+
+		detail::cache_entries<key, result, key_hash> entries_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_RESULT_CACHE_HPP
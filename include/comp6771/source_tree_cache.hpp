@@ -0,0 +1,46 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_SOURCE_TREE_CACHE_HPP
+#define COMP6771_SOURCE_TREE_CACHE_HPP
+
+#include <comp6771/cache_entries.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace word_ladder {
+	// Answers queries against a word_graph by keeping each source word's breadth-first search
+	// tree. The tree holds the word's distance to every word it can reach, and a word's
+	// predecessors are its neighbours one step closer. A later query from the same word, to any
+	// destination, then only has to walk the tree back from its destination. Trees are evicted
+	// least recently used first, once together they take up more than the byte budget. A tree
+	// bigger than the whole budget is used once and not kept.
+	//
+	// A miss costs more than generate(), because it searches the source word's whole component
+	// rather than meeting in the middle. The cache pays off for sources that are queried again
+	// and again. It may be used from several threads at once.
+	class source_tree_cache {
+	public:
+		source_tree_cache(word_graph const& graph, std::size_t budget_bytes);
+
+		// Returns what generate() would for the same query
+		[[nodiscard]] auto generate(std::string const& from, std::string const& to)
+		   -> std::vector<std::vector<std::string>>;
+
+		[[nodiscard]] auto stats() const -> cache_stats;
+		auto clear() -> void;
+
+	private:
+		word_graph const* graph_;
+		// Each source word's distance to every word of its length
+		detail::cache_entries<std::string, std::shared_ptr<std::vector<std::uint32_t> const>> trees_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_SOURCE_TREE_CACHE_HPP
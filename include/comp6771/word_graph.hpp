@@ -0,0 +1,89 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_WORD_GRAPH_HPP
+#define COMP6771_WORD_GRAPH_HPP
+
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// The graph of one-letter steps between the words of a lexicon. Words of each length get dense
+	// integer ids, and each word's neighbours are stored in compressed sparse row form: one offsets
+	// array and one flat array of neighbour ids. Searching it needs no hashing and no allocation
+	// beyond a few arrays sized to the number of words of the query's length.
+	//
+	// The graph is immutable once built and may be shared by any number of queries. Its arrays are
+	// views into storage shared by every copy of the graph: either buffers built in memory or a
+	// snapshot file mapped by map_word_graph(). The connected components of each length are taken
+	// from the neighbor_index the graph is built from, so a query between two words with no ladder
+	// between them can be answered without searching.
+	class word_graph {
+	public:
+		using word_id = std::uint32_t;
+
+		// All words of a single length and the steps between them. A word's id is its position in
+		// sorted order, so comparing ids compares the words they stand for.
+		class partition {
+		public:
+			[[nodiscard]] auto length() const -> std::size_t;
+			[[nodiscard]] auto size() const -> std::size_t;
+			[[nodiscard]] auto word(word_id id) const -> std::string_view;
+			[[nodiscard]] auto find(std::string_view word) const -> std::optional<word_id>;
+			// Returns the ids of every word one step from `id`, in ascending order.
+			[[nodiscard]] auto neighbors(word_id id) const -> std::span<word_id const>;
+			// Returns a label shared by every word that `id` has a ladder to, and no other word.
+			[[nodiscard]] auto component(word_id id) const -> word_id;
+			// Returns whether there is any ladder between `from` and `to`, in constant time.
+			[[nodiscard]] auto connected(word_id from, word_id to) const -> bool;
+
+		private:
+			friend class word_graph;
+			friend auto save_word_graph(word_graph const& graph, std::string const& path) -> void;
+			friend auto map_word_graph(std::string const& path) -> word_graph;
+
+			std::size_t length_ = 0;
+			std::string_view words_;
+			std::span<std::uint32_t const> offsets_;
+			std::span<word_id const> neighbors_;
+			std::span<word_id const> components_;
+		};
+
+		word_graph() = default;
+		explicit word_graph(std::unordered_set<std::string> const& lexicon);
+		explicit word_graph(lexicon const& words);
+		explicit word_graph(neighbor_index const& index);
+
+		// Returns the partition holding every word of `length`, or nullptr if there are none.
+		[[nodiscard]] auto words_of_length(std::size_t length) const -> partition const*;
+
+	private:
+		friend auto save_word_graph(word_graph const& graph, std::string const& path) -> void;
+		friend auto map_word_graph(std::string const& path) -> word_graph;
+
+		std::shared_ptr<void const> storage_;
+		std::vector<partition> partitions_;
+	};
+
+	// Writes `graph` to `path` as a binary snapshot: a versioned header followed by the sorted word
+	// table, CSR offsets, neighbour ids and component labels of each word length, in native byte
+	// order.
+	auto save_word_graph(word_graph const& graph, std::string const& path) -> void;
+
+	// Maps a snapshot written by save_word_graph() read-only and returns a graph that views it in
+	// place, so it can be queried without parsing or rebuilding anything. Throws std::runtime_error
+	// if the file is not a snapshot of this version and byte order.
+	[[nodiscard]] auto map_word_graph(std::string const& path) -> word_graph;
+} // namespace word_ladder
+
+#endif // COMP6771_WORD_GRAPH_HPP
@@ -4,31 +4,360 @@
 #ifndef COMP6771_WORD_LADDER_HPP
 #define COMP6771_WORD_LADDER_HPP
 
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/packed_lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_rows.hpp>
+
 #include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
 #include <queue>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
+#include <span>
+#include <utility>
 
 namespace word_ladder {
 	[[nodiscard]] auto read_lexicon(std::string const& path) -> std::unordered_set<std::string>;
 
+	// What a query did and where its time went. Each query adds to the counts and times already
+	// there, so one search_stats can total up many queries; `peak_frontier` keeps the largest.
+	struct search_stats {
+		// Words taken off a frontier and expanded
+		std::uint64_t dequeued = 0;
+		// Possible next words produced from them: strings tried against the lexicon, or the words an
+		// index hands back
+		std::uint64_t candidates = 0;
+		// Lookups of a candidate: one in the lexicon for each string tried, and one in the search's
+		// own frontier and visited words for each step found
+		std::uint64_t probes = 0;
+		// Candidates that were words of the lexicon
+		std::uint64_t hits = 0;
+		// Steps found between a word of one frontier and a word of the other
+		std::uint64_t intersections = 0;
+		// Layers expanded, from either end
+		std::uint64_t layers = 0;
+		// The most words in any frontier that was expanded
+		std::uint64_t peak_frontier = 0;
+		std::chrono::nanoseconds search_time{0};
+		// Walking the predecessor lists to build the ladders, not counting sorting them
+		std::chrono::nanoseconds rebuild_time{0};
+		std::chrono::nanoseconds sort_time{0};
+	};
+
 	// Given a start word and destination word, returns all the shortest possible paths from the
 	// start word to the destination, where each word in an individual path is a valid word per the
 	// provided lexicon. Pre: ranges::size(from) == ranges::size(to) Pre: valid_words.contains(from)
 	// and valid_words.contains(to)
+	//
+	// All of the search's scratch (its sets, predecessor lists and buffers) is allocated from
+	// `arena`, which is never asked to free anything. Without an arena, the call uses a
+	// std::pmr::monotonic_buffer_resource of its own, which starts on the stack. To reuse memory
+	// across many queries, pass your own monotonic resource and release() it between them. Only
+	// the returned ladders are allocated normally.
+	//
+	// If `stats` is given, what the query did is added to it. Without it, nothing is counted or
+	// timed at all.
 	[[nodiscard]] auto generate(std::string const& from,
 	                            std::string const& to,
-	                            std::unordered_set<std::string> const& lexicon)
-	   -> std::vector<std::vector<std::string>>;
+	                            std::unordered_set<std::string> const& lexicon,
+	                            std::pmr::memory_resource* arena = nullptr,
+	                            search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
+	// As above, but goes straight to the words of the query's length in a length-partitioned
+	// lexicon from load_lexicon() instead of filtering the whole lexicon on every call.
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            lexicon const& words,
+	                            std::pmr::memory_resource* arena = nullptr,
+	                            search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
+	// As above, but finds each word's neighbours by scanning its wildcard buckets in a prebuilt
+	// index. Build the index once per lexicon and reuse it across queries. Two words in different
+	// components of the index have no ladder, and are answered without a search. Of the other
+	// overloads, only the word_graph one does the same; the rest always search.
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            neighbor_index const& index,
+	                            std::pmr::memory_resource* arena = nullptr,
+	                            search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
+	// As above, but finds each word's neighbours by comparing it with every word of its length in
+	// a word_rows. This only pays off for lengths with few words.
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            word_rows const& rows,
+	                            std::pmr::memory_resource* arena = nullptr,
+	                            search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
+	// As above, but searches with every word held as a 64-bit key, five bits to a letter: the
+	// lexicon, the frontiers and the visited set are flat tables of keys, and a word's neighbours
+	// are made by XOR. Queries of a length the packed lexicon does not pack fall back to generate()
+	// over its words().
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            packed_lexicon const& words,
+	                            std::pmr::memory_resource* arena = nullptr,
+	                            search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
+	// As above, but searches a prebuilt word_graph by integer id. `from` and `to` must both be words
+	// of the graph (unless they are equal); otherwise there are no ladders. Each thread keeps its
+	// search buffers from one call to the next.
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            word_graph const& graph) -> std::vector<std::vector<std::string>>;
+
+	// Each word's distance from one end of a search over a word_graph, indexed by word id. Every
+	// distance is stamped with the search that wrote it and reads as `unreached` in any later
+	// search, so starting a search is one increment rather than a pass over every word of the
+	// length.
+	class search_distances {
+	public:
+		static constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+
+		// Forgets every distance, ready for a search over `size` words
+		auto reset(std::size_t size) -> void;
+
+		[[nodiscard]] auto operator[](word_graph::word_id id) const -> std::uint32_t {
+			auto const& e = entries_[id];
+			return e.stamp == stamp_ ? e.distance : unreached;
+		}
+
+		auto set(word_graph::word_id id, std::uint32_t distance) -> void {
+			entries_[id] = entry{stamp_, distance};
+		}
+
+	private:
+		// Side by side, so reading a distance touches one cache line
+		struct entry {
+			std::uint32_t stamp = 0;
+			std::uint32_t distance = 0;
+		};
+
+		std::vector<entry> entries_;
+		std::uint32_t stamp_ = 0;
+	};
+
+	// Working memory for a search over a word_graph. Keeping one per thread and reusing it across
+	// queries means a search only allocates when it needs more room than any search before it.
+	struct search_buffers {
+		search_distances from_source;
+		search_distances to_target;
+		std::vector<word_graph::word_id> front;
+		std::vector<word_graph::word_id> back;
+		std::vector<word_graph::word_id> layer;
+	};
+
+	// The shortest ladders between two words of a word_graph, produced one at a time in sorted
+	// order instead of all at once. The search runs when the range is constructed, and it keeps only
+	// the words that lie on some shortest ladder. Each increment then walks that DAG (directed
+	// acyclic graph) to the next ladder without ever reaching a dead end. A caller who stops after
+	// the first few ladders, or who streams them somewhere else, never builds the rest.
+	//
+	// Each ladder is a list of views into the graph (or into the range itself, for the one-word
+	// ladder when `from == to`). The views are only valid until the iterator is next incremented;
+	// copy them if you need to keep them. The graph must outlive the range, and the range must not
+	// be moved while you are iterating over it.
+	class ladder_range {
+	public:
+		using word_id = word_graph::word_id;
+
+		class iterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::vector<std::string_view>;
+			using reference = value_type const&;
+			using pointer = value_type const*;
+
+			iterator() = default;
+
+			[[nodiscard]] auto operator*() const -> reference;
+			[[nodiscard]] auto operator->() const -> pointer;
+			auto operator++() -> iterator&;
+			auto operator++(int) -> void;
+			[[nodiscard]] friend auto operator==(iterator const& it, std::default_sentinel_t) -> bool {
+				return it.at_end();
+			}
+
+		private:
+			friend class ladder_range;
+			explicit iterator(ladder_range* range)
+			: range_(range) {}
+
+			[[nodiscard]] auto at_end() const -> bool;
+
+			ladder_range* range_ = nullptr;
+		};
+
+		ladder_range() = default;
+		ladder_range(std::string const& from, std::string const& to, word_graph const& graph);
+
+		// Points the range at another query, keeping the memory it has already allocated. Any
+		// iterator into the range is invalidated.
+		auto reset(std::string const& from, std::string const& to, word_graph const& graph) -> void;
+
+		// Restarts the walk, so a range can be iterated more than once
+		[[nodiscard]] auto begin() -> iterator;
+		[[nodiscard]] auto end() const -> std::default_sentinel_t;
+
+	private:
+		// A word on the current ladder, and the index of the next neighbour to try after it
+		struct step {
+			word_id word;
+			std::uint32_t next;
+		};
+
+		friend auto generate_batch(std::span<std::pair<std::string, std::string> const> queries,
+		                           word_graph const& graph)
+		   -> std::vector<std::vector<std::vector<std::string>>>;
+
+		friend class source_tree_cache;
+		friend auto find_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+		   -> class ladder_set;
+		friend auto count_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+		   -> struct ladder_count;
+		friend auto generate_parallel(std::string const& from,
+		                              std::string const& to,
+		                              word_graph const& graph,
+		                              std::size_t threads) -> std::vector<std::vector<std::string>>;
+
+		// Walks ladders already found by the caller: `positions` as described below
+		ladder_range(word_graph::partition const& words,
+		             word_id source,
+		             word_id target,
+		             std::vector<std::uint32_t> positions);
+
+		// Moves to the next ladder, or sets `done_` if there are none left
+		auto advance() -> void;
+
+		std::string from_;
+		word_graph::partition const* words_ = nullptr;
+		word_id source_ = 0;
+		word_id target_ = 0;
+		// How many steps from the source each word sits on a shortest ladder, or UINT32_MAX for
+		// words that are on none
+		std::vector<std::uint32_t> position_;
+		// The words given a position by the last search, so the next one need only clear those
+		std::vector<word_id> on_ladder_;
+		std::vector<step> path_;
+		std::vector<std::string_view> ladder_;
+		search_buffers buffers_;
+		bool found_ = false;
+		bool done_ = true;
+	};
+
+	// Returns a range that yields every shortest ladder from `from` to `to` lazily, in the same
+	// order generate() returns them.
+	[[nodiscard]] auto
+	enumerate_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_range;
+
+	// Every shortest ladder between two words of a word_graph, held as the words' ids rather than as
+	// strings. All ladders are stored back to back in one flat array, so the whole result is a
+	// single allocation of four bytes per word, and the words themselves are only read from the
+	// graph when asked for. Ids are ordered the same way as the words they stand for, so comparing
+	// two ladders' ids compares the ladders. The graph must outlive the set.
+	class ladder_set {
+	public:
+		using word_id = word_graph::word_id;
+
+		ladder_set() = default;
+
+		[[nodiscard]] auto size() const -> std::size_t;
+		[[nodiscard]] auto empty() const -> bool;
+		// How many words each ladder has
+		[[nodiscard]] auto ladder_length() const -> std::size_t;
+
+		// Returns the ids of the words of the `i`th ladder, in sorted order of ladders
+		[[nodiscard]] auto operator[](std::size_t i) const -> std::span<word_id const>;
+		[[nodiscard]] auto word(word_id id) const -> std::string_view;
+
+		// Copies the `i`th ladder, or every ladder, out as strings
+		[[nodiscard]] auto ladder(std::size_t i) const -> std::vector<std::string>;
+		[[nodiscard]] auto to_strings() const -> std::vector<std::vector<std::string>>;
+
+		[[nodiscard]] friend auto operator==(ladder_set const&, ladder_set const&) -> bool = default;
+
+	private:
+		friend auto find_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+		   -> ladder_set;
+
+		word_graph::partition const* words_ = nullptr;
+		std::size_t length_ = 0;
+		std::vector<word_id> ids_;
+	};
+
+	// As generate() over a word_graph, but returns the ladders as ids. Unlike generate(), a word
+	// that is not in the graph has no ladder even to itself, since it has no id.
+	[[nodiscard]] auto
+	find_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_set;
+
+	// As generate() over a word_graph, but for a single large query: each layer of the search is
+	// split between `threads` threads. Small layers are still expanded on the calling thread. Returns
+	// exactly what generate() does.
+	[[nodiscard]] auto generate_parallel(std::string const& from,
+	                                     std::string const& to,
+	                                     word_graph const& graph,
+	                                     std::size_t threads) -> std::vector<std::vector<std::string>>;
+
+	// Solves many queries against one lexicon, returning each query's ladders (as generate() over
+	// its word_graph would) in the order the queries were given. Both words of a query must be
+	// words of the lexicon, unless they are equal; otherwise the query has no ladders, even where
+	// generate() over the lexicon itself would find some from a source that is not a word. The
+	// lexicon's word graph is built once for the whole batch. Queries that share a source word
+	// share a single search outward from it, instead of each running its own.
+	[[nodiscard]] auto generate_batch(std::span<std::pair<std::string, std::string> const> queries,
+	                                  lexicon const& words)
+	   -> std::vector<std::vector<std::vector<std::string>>>;
+
+	// As above, for a graph that has already been built or mapped from a snapshot
+	[[nodiscard]] auto generate_batch(std::span<std::pair<std::string, std::string> const> queries,
+	                                  word_graph const& graph)
+	   -> std::vector<std::vector<std::vector<std::string>>>;
+
+	// How many shortest ladders there are between two words, and how many words each one has.
+	// Both are zero if there is no ladder.
+	struct ladder_count {
+		std::uint64_t ladders = 0;
+		std::size_t length = 0;
+	};
+
+	// Counts the shortest ladders from `from` to `to` without building any of them, by summing path
+	// counts layer by layer over the search's shortest-path DAG. Takes time linear in the part of
+	// the graph the search explores, however many ladders there are: each thread reuses its search
+	// buffers and counts from one call to the next. Throws std::overflow_error if the count does
+	// not fit in 64 bits.
+	[[nodiscard]] auto
+	count_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_count;
 
 	[[nodiscard]] auto rebuild_ladders(std::vector<std::string>& ladder,
 	                                   std::vector<std::vector<std::string>>& intersections)
 	   -> std::vector<std::vector<std::string>>;
 
+	// Returns every ladder from `from` to `to` in the shortest-path DAG described by `parents`,
+	// sorted. `parents` maps each word to the words one step closer to `from` that lead to it;
+	// `from` itself maps to an empty list. If `stats` is given, the time spent walking and sorting
+	// is added to it.
+	[[nodiscard]] auto
+	rebuild_ladders(std::string const& from,
+	                std::string const& to,
+	                std::unordered_map<std::string, std::vector<std::string>> const& parents,
+	                search_stats* stats = nullptr) -> std::vector<std::vector<std::string>>;
+
 } // namespace word_ladder
 
 #endif // COMP6771_WORD_LADDER_HPP
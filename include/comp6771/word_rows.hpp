@@ -0,0 +1,94 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_WORD_ROWS_HPP
+#define COMP6771_WORD_ROWS_HPP
+
+#include <comp6771/lexicon.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// The words of a lexicon laid out for brute-force neighbour scans. The words of each length are
+	// sorted and stored as fixed-width rows, zero-padded to a multiple of 16 bytes. To find a word's
+	// neighbours, the scan compares the word with every row of its length, 16 or 32 bytes at a time
+	// (with SSE2 or AVX2, where the compiler targets them), and keeps the rows that differ from it
+	// in exactly one byte. Without either, it compares a byte at a time.
+	//
+	// A scan costs time linear in the number of words of the length, but it does no hashing and
+	// builds no candidate strings, so it suits lengths with few words. The rows are immutable once
+	// built and may be shared by any number of queries.
+	class word_rows {
+	public:
+		word_rows() = default;
+		explicit word_rows(std::unordered_set<std::string> const& lexicon);
+		explicit word_rows(lexicon const& words);
+
+		[[nodiscard]] auto contains(std::string_view word) const -> bool;
+
+		// Returns how many words of `length` there are. A word's id is its row, so the ids run from
+		// 0 to one less than this, in sorted order.
+		[[nodiscard]] auto word_count(std::size_t length) const -> std::size_t;
+
+		// Returns the id of `word` among the words of its length, or std::nullopt if it is not one
+		// of the words
+		[[nodiscard]] auto find(std::string_view word) const -> std::optional<std::uint32_t>;
+
+		// Calls `f` with every word that differs from `word` in exactly one letter, in sorted order.
+		// `word` need not be one of the words itself.
+		template<typename F>
+		auto for_each_neighbor(std::string_view word, F&& f) const -> void {
+			for_each_neighbor_id(word, [&f](std::uint32_t, std::string_view next) { f(next); });
+		}
+
+		// As for_each_neighbor(), but calls `f(id, word)` with each word's id as well
+		template<typename F>
+		auto for_each_neighbor_id(std::string_view word, F&& f) const -> void {
+			auto const* const part = find_partition(word.size());
+			if (part == nullptr) {
+				return;
+			}
+			auto hits = std::array<std::uint32_t, rows_per_scan>{};
+			for (auto first = std::size_t{0}; first < part->size(); first += rows_per_scan) {
+				auto const found = part->scan(word, first, hits.data());
+				for (auto i = std::size_t{0}; i < found; ++i) {
+					f(hits[i], part->word(hits[i]));
+				}
+			}
+		}
+
+	private:
+		// How many rows one call to scan() compares, so its hits fit in a buffer on the stack
+		static constexpr auto rows_per_scan = std::size_t{256};
+
+		// All words of one length. Row i holds the ith word in sorted order.
+		struct partition {
+			std::size_t length = 0;
+			std::size_t stride = 0;
+			std::vector<char> rows;
+
+			[[nodiscard]] auto size() const -> std::size_t;
+			[[nodiscard]] auto word(std::size_t row) const -> std::string_view;
+
+			// Compares `word` with rows [first, first + rows_per_scan), writing the index of each
+			// row one letter away from it to `hits`. Returns how many there were.
+			auto scan(std::string_view word, std::size_t first, std::uint32_t* hits) const
+			   -> std::size_t;
+		};
+
+		auto build(std::vector<std::vector<std::string_view>>& by_length) -> void;
+		[[nodiscard]] auto find_partition(std::size_t length) const -> partition const*;
+
+		// Indexed by word length
+		std::vector<partition> partitions_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_WORD_ROWS_HPP
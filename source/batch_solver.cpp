@@ -0,0 +1,154 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/batch_solver.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+namespace word_ladder {
+	batch_solver::batch_solver(word_graph const& graph, std::size_t threads)
+	: graph_(&graph) {
+		threads = std::max(threads, std::size_t{1});
+		queues_.reserve(threads);
+		std::generate_n(std::back_inserter(queues_), threads, [] {
+			return std::make_unique<work_queue>();
+		});
+		scratch_.resize(threads);
+		workers_.reserve(threads);
+		for (auto worker = std::size_t{0}; worker < threads; ++worker) {
+			workers_.emplace_back([this, worker] { run(worker); });
+		}
+	}
+
+	batch_solver::~batch_solver() {
+		{
+			auto const guard = std::scoped_lock(lock_);
+			stopping_ = true;
+		}
+		start_.notify_all();
+		std::for_each(workers_.begin(), workers_.end(), [](auto& worker) { worker.join(); });
+	}
+
+	auto batch_solver::thread_count() const -> std::size_t {
+		return workers_.size();
+	}
+
+	auto batch_solver::solve(std::span<std::pair<std::string, std::string> const> queries)
+	   -> std::vector<std::vector<std::vector<std::string>>> {
+		auto const serial = std::scoped_lock(solving_);
+		auto results = std::vector<std::vector<std::vector<std::string>>>(queries.size());
+
+		// Neighbouring queries often share a word length, so each worker starts on a contiguous run
+		auto const share = (queries.size() + queues_.size() - 1) / queues_.size();
+		for (auto worker = std::size_t{0}; worker < queues_.size(); ++worker) {
+			auto& queue = *queues_[worker];
+			auto const guard = std::scoped_lock(queue.lock);
+			queue.begin = std::min(worker * share, queries.size());
+			queue.end = std::min(queue.begin + share, queries.size());
+		}
+
+		{
+			auto const guard = std::scoped_lock(lock_);
+			queries_ = queries;
+			results_ = &results;
+			busy_ = workers_.size();
+			error_ = nullptr;
+			++batch_;
+		}
+		start_.notify_all();
+
+		auto guard = std::unique_lock(lock_);
+		finished_.wait(guard, [this] { return busy_ == 0; });
+		results_ = nullptr;
+		if (error_) {
+			std::rethrow_exception(error_);
+		}
+		return results;
+	}
+
+	// Waits for each batch in turn and helps solve it
+	auto batch_solver::run(std::size_t worker) -> void {
+		auto seen = std::uint64_t{0};
+		while (true) {
+			{
+				auto guard = std::unique_lock(lock_);
+				start_.wait(guard, [this, seen] { return stopping_ or batch_ != seen; });
+				if (stopping_) {
+					return;
+				}
+				seen = batch_;
+			}
+
+			try {
+				work(worker);
+			} catch (...) {
+				auto const guard = std::scoped_lock(lock_);
+				if (!error_) {
+					error_ = std::current_exception();
+				}
+			}
+
+			auto const guard = std::scoped_lock(lock_);
+			if (--busy_ == 0) {
+				finished_.notify_one();
+			}
+		}
+	}
+
+	// Solves queries until neither this worker nor any other has any left to start
+	auto batch_solver::work(std::size_t worker) -> void {
+		auto& ladders = scratch_[worker];
+		while (true) {
+			auto const next = take(worker);
+			if (!next) {
+				if (steal(worker)) {
+					continue;
+				}
+				return;
+			}
+
+			auto const& [from, to] = queries_[*next];
+			ladders.reset(from, to, *graph_);
+			auto& result = (*results_)[*next];
+			std::ranges::transform(ladders, std::back_inserter(result), [](auto const& ladder) {
+				return std::vector<std::string>(ladder.begin(), ladder.end());
+			});
+		}
+	}
+
+	auto batch_solver::take(std::size_t worker) -> std::optional<std::size_t> {
+		auto& queue = *queues_[worker];
+		auto const guard = std::scoped_lock(queue.lock);
+		if (queue.begin == queue.end) {
+			return std::nullopt;
+		}
+		return queue.begin++;
+	}
+
+	// Moves the back half of the first non-empty queue after the thief's own into the thief's
+	// queue. Returns false if every queue was empty.
+	auto batch_solver::steal(std::size_t thief) -> bool {
+		for (auto offset = std::size_t{1}; offset < queues_.size(); ++offset) {
+			auto& victim = *queues_[(thief + offset) % queues_.size()];
+			auto stolen = std::pair<std::size_t, std::size_t>{};
+			{
+				auto const guard = std::scoped_lock(victim.lock);
+				auto const remaining = victim.end - victim.begin;
+				if (remaining == 0) {
+					continue;
+				}
+				stolen = {victim.end - (remaining + 1) / 2, victim.end};
+				victim.end = stolen.first;
+			}
+
+			auto& own = *queues_[thief];
+			auto const guard = std::scoped_lock(own.lock);
+			own.begin = stolen.first;
+			own.end = stolen.second;
+			return true;
+		}
+		return false;
+	}
+} // namespace word_ladder
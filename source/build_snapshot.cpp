@@ -0,0 +1,27 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+
+#include <exception>
+#include <iostream>
+
+// Compiles a word list into a word graph snapshot that map_word_graph() can load without
+// rebuilding anything, e.g.
+//
+//     build_snapshot english.txt english.wlg
+auto main(int argc, char* argv[]) -> int {
+	if (argc != 3) {
+		std::cerr << "usage: " << argv[0] << " <lexicon> <snapshot>\n";
+		return 1;
+	}
+
+	try {
+		auto const graph = word_ladder::word_graph(word_ladder::map_lexicon(argv[1]));
+		word_ladder::save_word_graph(graph, argv[2]);
+	} catch (std::exception const& e) {
+		std::cerr << argv[0] << ": " << e.what() << '\n';
+		return 1;
+	}
+}
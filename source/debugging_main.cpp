@@ -1,4 +1,5 @@
 #include "comp6771/word_ladder.hpp"
+#include <iterator>
 
 //#include <ranges>
 
@@ -0,0 +1,100 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#ifndef COMP6771_GRAPH_SEARCH_HPP
+#define COMP6771_GRAPH_SEARCH_HPP
+
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+// The parts of the word_graph searches that the libraries built on word_ladder share. This header
+// lives with the sources and is not part of the public interface.
+namespace word_ladder::detail {
+	using word_id = word_graph::word_id;
+
+	constexpr auto unreached = search_distances::unreached;
+
+	// Keeps only the words on some shortest ladder, by walking back from `target` one position
+	// at a time. Every other word is given `unreached` in `positions`, so a walk forward from
+	// the source that only ever steps one position further along can never reach a dead end.
+	// `on_ladder` is left holding every word kept, from the target back to the source. `found`
+	// is any search result with a `length` and a `position(id)` like graph_search's.
+	//
+	// If `positions` and `on_ladder` are what the last call left, only the words kept then are
+	// cleared, so a caller that reuses both never fills a whole array. Otherwise `on_ladder`
+	// must be empty, or `positions` the wrong size, and `positions` is filled afresh.
+	template<typename Search>
+	auto ladder_positions(word_graph::partition const& words,
+	                      Search const& found,
+	                      word_id target,
+	                      std::vector<std::uint32_t>& positions,
+	                      std::vector<word_id>& on_ladder) -> void {
+		if (positions.size() != words.size() or on_ladder.empty()) {
+			positions.assign(words.size(), unreached);
+		}
+		else {
+			std::for_each(on_ladder.begin(), on_ladder.end(), [&positions](word_id word) {
+				positions[word] = unreached;
+			});
+		}
+		positions[target] = found.length;
+		on_ladder.assign(1, target);
+		for (auto i = std::size_t{0}; i < on_ladder.size(); ++i) {
+			auto const word = on_ladder[i];
+			auto const position = positions[word];
+			if (position == 0) {
+				continue;
+			}
+			for (auto const previous : words.neighbors(word)) {
+				if (positions[previous] == unreached and found.position(previous) == position - 1) {
+					positions[previous] = position - 1;
+					on_ladder.push_back(previous);
+				}
+			}
+		}
+	}
+
+	// Distances from one source, shared by every query from that source (a batch's, or a
+	// cache's). Positions along a ladder are plain distances.
+	struct source_search {
+		std::span<std::uint32_t const> from_source;
+		std::uint32_t length = unreached;
+
+		[[nodiscard]] auto position(word_id id) const -> std::uint32_t {
+			return from_source[id];
+		}
+	};
+
+	// Grows a single frontier from `source`, one layer at a time, until every word in `targets`
+	// has been reached or there is nothing left to reach. With no targets, it reaches every
+	// word it can. Returns each word's distance from `source`.
+	[[nodiscard]] auto search_from(word_graph::partition const& words,
+	                               word_id source,
+	                               std::vector<word_id> const& targets) -> std::vector<std::uint32_t>;
+
+	// The words of a query that may have ladders between them, as ids in their partition
+	struct graph_query {
+		word_graph::partition const* words = nullptr;
+		word_id source = 0;
+		word_id target = 0;
+	};
+
+	// Returns the ids of `from` and `to`, or std::nullopt if they are not both words of one length
+	// of the graph in the same component, so that there is no ladder to find. Pre: from != to
+	[[nodiscard]] auto
+	find_query(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> std::optional<graph_query>;
+
+	// Copies every ladder of `ladders` out as strings
+	[[nodiscard]] auto copy_ladders(ladder_range& ladders) -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder::detail
+
+#endif // COMP6771_GRAPH_SEARCH_HPP
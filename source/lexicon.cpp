@@ -1,11 +1,17 @@
 // Copyright (c) Christopher Di Bella.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
+#include <comp6771/lexicon.hpp>
+#include <comp6771/mapped_file.hpp>
 #include <comp6771/word_ladder.hpp>
 
 #include <unordered_set>
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <fstream>
 #include <iterator>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 
@@ -28,4 +34,96 @@ namespace word_ladder {
 		}
 		return lexicon;
 	}
+
+	auto load_lexicon(std::string const& path) -> lexicon {
+		auto in = std::ifstream(path.data());
+		if (not in) {
+			throw std::runtime_error("Unable to open file.");
+		}
+
+		auto text = std::ostringstream{};
+		text << in.rdbuf();
+		if (in.bad()) {
+			throw std::runtime_error("I/O error while reading");
+		}
+		auto const storage = std::make_shared<std::string const>(std::move(text).str());
+		return lexicon(storage, *storage);
+	}
+
+	auto map_lexicon(std::string const& path) -> lexicon {
+		auto file = map_file(path);
+		return lexicon(std::move(file.storage), file.contents);
+	}
+
+	lexicon::lexicon(std::unordered_set<std::string> const& words) {
+		auto text = std::string{};
+		std::for_each(words.begin(), words.end(), [&text](auto const& word) {
+			text.append(word);
+			text.push_back('\n');
+		});
+		auto const storage = std::make_shared<std::string const>(std::move(text));
+		*this = lexicon(storage, *storage);
+	}
+
+	// Splits `text` on whitespace, filing each word under its length
+	lexicon::lexicon(std::shared_ptr<void const> storage, std::string_view all) {
+		auto built = std::make_shared<contents>();
+		built->storage = std::move(storage);
+		auto& partitions = built->partitions;
+
+		auto const is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+		auto first = std::find_if_not(all.begin(), all.end(), is_space);
+		while (first != all.end()) {
+			auto const last = std::find_if(first, all.end(), is_space);
+			auto const word = std::string_view(first, last);
+			if (partitions.size() <= word.size()) {
+				partitions.resize(word.size() + 1);
+			}
+			if (partitions[word.size()].words.insert(word).second) {
+				++built->size;
+			}
+			first = std::find_if_not(last, all.end(), is_space);
+		}
+
+		std::for_each(partitions.begin(), partitions.end(), [](auto& part) {
+			auto used = std::array<bool, 256>{};
+			std::for_each(part.words.begin(), part.words.end(), [&used](auto word) {
+				std::for_each(word.begin(), word.end(), [&used](unsigned char c) { used[c] = true; });
+			});
+			for (auto c = std::size_t{0}; c < used.size(); ++c) {
+				if (used[c]) {
+					part.letters.push_back(static_cast<char>(c));
+				}
+			}
+		});
+		words_ = std::move(built);
+	}
+
+	auto lexicon::size() const -> std::size_t {
+		return words_ ? words_->size : 0;
+	}
+
+	auto lexicon::max_length() const -> std::size_t {
+		return words_ and !words_->partitions.empty() ? words_->partitions.size() - 1 : 0;
+	}
+
+	auto lexicon::contains(std::string_view word) const -> bool {
+		return words_of_length(word.size()).contains(word);
+	}
+
+	auto lexicon::identity() const -> void const* {
+		return words_.get();
+	}
+
+	auto lexicon::words_of_length(std::size_t length) const
+	   -> std::unordered_set<std::string_view> const& {
+		static auto const none = std::unordered_set<std::string_view>{};
+		return words_ and length < words_->partitions.size() ? words_->partitions[length].words
+		                                                      : none;
+	}
+
+	auto lexicon::letters_of_length(std::size_t length) const -> std::string_view {
+		return words_ and length < words_->partitions.size() ? words_->partitions[length].letters
+		                                                      : std::string_view{};
+	}
 } // namespace word_ladder
@@ -0,0 +1,63 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/mapped_file.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace word_ladder {
+	auto map_file(std::string const& path) -> mapped_file {
+#if defined(_WIN32)
+		auto in = std::ifstream(path.data(), std::ios::binary);
+		if (not in) {
+			throw std::runtime_error("Unable to open file.");
+		}
+
+		auto text = std::ostringstream{};
+		text << in.rdbuf();
+		if (in.bad()) {
+			throw std::runtime_error("I/O error while reading");
+		}
+		auto const storage = std::make_shared<std::string const>(std::move(text).str());
+		return {storage, *storage};
+#else
+		auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd == -1) {
+			throw std::runtime_error("Unable to open file.");
+		}
+
+		struct ::stat status {};
+		if (::fstat(fd, &status) == -1) {
+			::close(fd);
+			throw std::runtime_error("I/O error while reading");
+		}
+		auto const size = static_cast<std::size_t>(status.st_size);
+		if (size == 0) {
+			::close(fd);
+			return {};
+		}
+
+		auto* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (mapping == MAP_FAILED) {
+			throw std::runtime_error("Unable to map file.");
+		}
+
+		auto storage = std::shared_ptr<void const>(mapping, [size](void const* p) {
+			::munmap(const_cast<void*>(p), size);
+		});
+		return {std::move(storage), std::string_view(static_cast<char const*>(mapping), size)};
+#endif
+	}
+} // namespace word_ladder
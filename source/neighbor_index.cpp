@@ -0,0 +1,200 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/neighbor_index.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+
+namespace word_ladder {
+	namespace {
+		// Orders two words of the same length as if letter `p` were missing from both
+		auto masked_compare(std::string_view a, std::string_view b, std::size_t p)
+		   -> std::strong_ordering {
+			if (auto const prefix = a.substr(0, p) <=> b.substr(0, p); prefix != 0) {
+				return prefix;
+			}
+			return a.substr(p + 1) <=> b.substr(p + 1);
+		}
+
+		// Labels each of `n` words with the smallest id in its connected component, by union-find
+		// over the buckets of every letter position: each word is joined to its bucket's first word
+		auto find_components(std::size_t n,
+		                     std::span<std::uint32_t const> order,
+		                     std::span<std::uint32_t const> bucket_begin)
+		   -> std::vector<std::uint32_t> {
+			auto parent = std::vector<std::uint32_t>(n);
+			std::iota(parent.begin(), parent.end(), std::uint32_t{0});
+			auto const find = [&parent](std::uint32_t id) {
+				while (parent[id] != id) {
+					parent[id] = parent[parent[id]];
+					id = parent[id];
+				}
+				return id;
+			};
+
+			for (auto k = std::size_t{0}; k < order.size(); ++k) {
+				auto const row = k - k % n;
+				auto const x = find(order[row + bucket_begin[k]]);
+				auto const y = find(order[k]);
+				// The smaller root always wins, so every root is its component's smallest id
+				if (x < y) {
+					parent[y] = x;
+				}
+				else if (y < x) {
+					parent[x] = y;
+				}
+			}
+			std::transform(parent.begin(), parent.end(), parent.begin(), find);
+			return parent;
+		}
+	} // namespace
+
+	neighbor_index::neighbor_index(std::unordered_set<std::string> const& lexicon) {
+		auto by_length = std::vector<std::vector<std::string_view>>{};
+		std::for_each(lexicon.begin(), lexicon.end(), [&by_length](auto const& s) {
+			if (by_length.size() <= s.size()) {
+				by_length.resize(s.size() + 1);
+			}
+			by_length[s.size()].push_back(s);
+		});
+		build(by_length);
+	}
+
+	neighbor_index::neighbor_index(lexicon const& words) {
+		auto by_length = std::vector<std::vector<std::string_view>>(words.max_length() + 1);
+		for (auto length = std::size_t{1}; length < by_length.size(); ++length) {
+			auto const& bucket = words.words_of_length(length);
+			by_length[length].assign(bucket.begin(), bucket.end());
+		}
+		build(by_length);
+	}
+
+	auto neighbor_index::build(std::vector<std::vector<std::string_view>>& by_length) -> void {
+		partitions_.resize(by_length.size());
+		for (auto length = std::size_t{1}; length < by_length.size(); ++length) {
+			auto& sorted = by_length[length];
+			std::sort(sorted.begin(), sorted.end());
+
+			auto& part = partitions_[length];
+			part.length = length;
+			part.words.reserve(sorted.size() * length);
+			std::for_each(sorted.begin(), sorted.end(), [&part](auto s) { part.words.append(s); });
+
+			auto const n = sorted.size();
+			part.order.resize(n * length);
+			part.bucket_begin.resize(n * length);
+			part.rank.resize(n * length);
+			for (auto p = std::size_t{0}; p < length; ++p) {
+				auto* const order = part.order.data() + p * n;
+				std::iota(order, order + n, std::uint32_t{0});
+				std::stable_sort(order, order + n, [&](auto x, auto y) {
+					return masked_compare(sorted[x], sorted[y], p) < 0;
+				});
+
+				auto const row = p * n;
+				for (auto k = std::size_t{0}; k < n; ++k) {
+					auto const starts_bucket =
+					   k == 0 or masked_compare(sorted[order[k - 1]], sorted[order[k]], p) != 0;
+					part.bucket_begin[row + k] =
+					   starts_bucket ? static_cast<std::uint32_t>(k) : part.bucket_begin[row + k - 1];
+					part.rank[row + order[k]] = static_cast<std::uint32_t>(k);
+				}
+			}
+			part.components = find_components(n, part.order, part.bucket_begin);
+		}
+	}
+
+	auto neighbor_index::contains(std::string_view word) const -> bool {
+		return find(word).has_value();
+	}
+
+	auto neighbor_index::word_count(std::size_t length) const -> std::size_t {
+		auto const* const part = find_partition(length);
+		return part == nullptr ? 0 : part->size();
+	}
+
+	auto neighbor_index::find(std::string_view word) const -> std::optional<std::uint32_t> {
+		auto const* const part = find_partition(word.size());
+		if (part == nullptr) {
+			return std::nullopt;
+		}
+		return part->find(word);
+	}
+
+	auto neighbor_index::component(std::size_t length, std::uint32_t id) const -> std::uint32_t {
+		return partitions_[length].components[id];
+	}
+
+	auto neighbor_index::connected(std::size_t length, std::uint32_t from, std::uint32_t to) const
+	   -> bool {
+		auto const& components = partitions_[length].components;
+		return components[from] == components[to];
+	}
+
+	auto neighbor_index::bucket(std::string_view pattern) const -> std::vector<std::string_view> {
+		auto const wildcard = pattern.find('*');
+		if (wildcard == std::string_view::npos or pattern.find('*', wildcard + 1) != pattern.npos) {
+			throw std::invalid_argument("Pattern must contain exactly one '*'.");
+		}
+
+		auto result = std::vector<std::string_view>{};
+		auto const* const part = find_partition(pattern.size());
+		if (part == nullptr) {
+			return result;
+		}
+
+		auto const [first, last] = part->equal_range(pattern, wildcard);
+		auto const* const order = part->order.data() + wildcard * part->size();
+		std::transform(order + first, order + last, std::back_inserter(result), [part](auto id) {
+			return part->word(id);
+		});
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	auto neighbor_index::find_partition(std::size_t length) const -> partition const* {
+		if (length == 0 or length >= partitions_.size() or partitions_[length].words.empty()) {
+			return nullptr;
+		}
+		return &partitions_[length];
+	}
+
+	auto neighbor_index::partition::size() const -> std::size_t {
+		return words.size() / length;
+	}
+
+	auto neighbor_index::partition::word(std::size_t id) const -> std::string_view {
+		return std::string_view(words).substr(id * length, length);
+	}
+
+	auto neighbor_index::partition::find(std::string_view target) const
+	   -> std::optional<std::uint32_t> {
+		auto const ids = std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(size()));
+		auto const found =
+		   std::ranges::lower_bound(ids, target, {}, [this](auto id) { return word(id); });
+		if (found == ids.end() or word(*found) != target) {
+			return std::nullopt;
+		}
+		return *found;
+	}
+
+	auto neighbor_index::partition::equal_range(std::string_view pattern, std::size_t p) const
+	   -> std::pair<std::size_t, std::size_t> {
+		auto const* const row = order.data() + p * size();
+		auto const* const first =
+		   std::lower_bound(row, row + size(), pattern, [this, p](auto id, auto key) {
+			   return masked_compare(word(id), key, p) < 0;
+		   });
+		auto const* const last =
+		   std::upper_bound(first, row + size(), pattern, [this, p](auto key, auto id) {
+			   return masked_compare(key, word(id), p) < 0;
+		   });
+		return {static_cast<std::size_t>(first - row), static_cast<std::size_t>(last - row)};
+	}
+} // namespace word_ladder
@@ -0,0 +1,83 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/packed_lexicon.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace word_ladder {
+	packed_lexicon::packed_lexicon(std::unordered_set<std::string> const& words)
+	: packed_lexicon(lexicon(words)) {}
+
+	packed_lexicon::packed_lexicon(lexicon words)
+	: words_(std::move(words))
+	, partitions_(std::min(words_.max_length(), max_length) + 1) {
+		for (auto length = std::size_t{1}; length < partitions_.size(); ++length) {
+			auto const& of_length = words_.words_of_length(length);
+			auto keys = std::vector<key>{};
+			keys.reserve(of_length.size());
+			auto const all_packed = std::all_of(of_length.begin(), of_length.end(), [&keys](auto word) {
+				auto const k = pack(word);
+				if (k) {
+					keys.push_back(*k);
+				}
+				return k.has_value();
+			});
+			if (keys.empty() or !all_packed) {
+				continue;
+			}
+
+			// At most half full, so a probe rarely runs past a slot or two
+			auto& part = partitions_[length];
+			part.slots.assign(std::bit_ceil(keys.size() * 2), 0);
+			part.shift = 64U - static_cast<unsigned>(std::countr_zero(part.slots.size()));
+			auto const mask = part.slots.size() - 1;
+			std::for_each(keys.begin(), keys.end(), [&part, mask](key k) {
+				auto i = part.slot(k);
+				while (part.slots[i] != 0) {
+					i = (i + 1) & mask;
+				}
+				part.slots[i] = k;
+				for (; k != 0; k >>= 5U) {
+					part.letters |= std::uint32_t{1} << (k & key{31});
+				}
+			});
+			part.packed = true;
+		}
+	}
+
+	auto packed_lexicon::pack(std::string_view word) -> std::optional<key> {
+		if (word.empty() or word.size() > max_length) {
+			return std::nullopt;
+		}
+		auto k = key{0};
+		for (auto i = word.size(); i-- > 0;) {
+			if (word[i] < 'a' or word[i] > 'z') {
+				return std::nullopt;
+			}
+			k = (k << 5U) | static_cast<key>(word[i] - 'a' + 1);
+		}
+		return k;
+	}
+
+	auto packed_lexicon::unpack(key k) -> std::string {
+		auto word = std::string{};
+		for (; k != 0; k >>= 5U) {
+			word.push_back(static_cast<char>('a' + (k & key{31}) - 1));
+		}
+		return word;
+	}
+
+	auto packed_lexicon::words() const -> lexicon const& {
+		return words_;
+	}
+
+	auto packed_lexicon::packed(std::size_t length) const -> bool {
+		return length < partitions_.size() and partitions_[length].packed;
+	}
+
+	auto packed_lexicon::letter_count(std::size_t length) const -> std::size_t {
+		return static_cast<std::size_t>(std::popcount(partitions_[length].letters));
+	}
+} // namespace word_ladder
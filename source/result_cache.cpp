@@ -0,0 +1,69 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/result_cache.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace word_ladder {
+	result_cache::result_cache(std::size_t budget_bytes)
+	: entries_(budget_bytes) {}
+
+	auto result_cache::key_hash::operator()(key const& k) const -> std::size_t {
+		auto seed = std::hash<void const*>{}(k.lexicon);
+		for (auto const* word : {&k.first, &k.second}) {
+			seed ^= std::hash<std::string>{}(*word) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+		return seed;
+	}
+
+	auto result_cache::generate(std::string const& from, std::string const& to, lexicon const& words)
+	   -> std::vector<std::vector<std::string>> {
+		if (from == to or !words.contains(from) or !words.contains(to)) {
+			return word_ladder::generate(from, to, words);
+		}
+
+		auto const reversed = to < from;
+		auto query = reversed ? key{words.identity(), to, from} : key{words.identity(), from, to};
+		auto found = std::shared_ptr<std::vector<std::vector<std::string>> const>{};
+		if (auto cached = entries_.find(query)) {
+			found = std::move(cached->ladders);
+		}
+
+		// The search runs without the lock, so other queries can be served meanwhile
+		if (!found) {
+			found = std::make_shared<std::vector<std::vector<std::string>> const>(
+			   word_ladder::generate(query.first, query.second, words));
+
+			auto bytes = query.first.size() + query.second.size();
+			std::for_each(found->begin(), found->end(), [&bytes](auto const& ladder) {
+				bytes += sizeof(ladder);
+				std::for_each(ladder.begin(), ladder.end(), [&bytes](auto const& word) {
+					bytes += sizeof(word) + word.size();
+				});
+			});
+			entries_.insert(std::move(query), result{words, found}, bytes);
+		}
+
+		// Copied only once the lock is released, so a large hit never holds up other threads
+		auto ladders = *found;
+		if (reversed) {
+			std::for_each(ladders.begin(), ladders.end(), [](auto& ladder) {
+				std::reverse(ladder.begin(), ladder.end());
+			});
+			std::sort(ladders.begin(), ladders.end());
+		}
+		return ladders;
+	}
+
+	auto result_cache::stats() const -> cache_stats {
+		return entries_.stats();
+	}
+
+	auto result_cache::clear() -> void {
+		entries_.clear();
+	}
+} // namespace word_ladder
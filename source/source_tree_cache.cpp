@@ -0,0 +1,56 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/source_tree_cache.hpp>
+
+#include "graph_search.hpp"
+
+#include <utility>
+
+namespace word_ladder {
+	source_tree_cache::source_tree_cache(word_graph const& graph, std::size_t budget_bytes)
+	: graph_(&graph)
+	, trees_(budget_bytes) {}
+
+	auto source_tree_cache::generate(std::string const& from, std::string const& to)
+	   -> std::vector<std::vector<std::string>> {
+		if (from == to) {
+			return {{from}};
+		}
+		auto const query = detail::find_query(from, to, *graph_);
+		if (!query) {
+			return {};
+		}
+		auto const& [words, source, target] = *query;
+
+		auto distances = trees_.find(from).value_or(nullptr);
+
+		// The search runs without the lock, so other sources can be served meanwhile. Two threads
+		// that miss on the same source both search it, and the first to finish keeps its tree.
+		if (!distances) {
+			distances = std::make_shared<std::vector<std::uint32_t> const>(
+			   detail::search_from(*words, source, {}));
+			trees_.insert(from, distances, distances->size() * sizeof(std::uint32_t) + from.size());
+		}
+
+		auto found = detail::source_search{*distances};
+		found.length = (*distances)[target];
+		if (found.length == detail::unreached) {
+			return {};
+		}
+		auto positions = std::vector<std::uint32_t>{};
+		auto on_ladder = std::vector<detail::word_id>{};
+		detail::ladder_positions(*words, found, target, positions, on_ladder);
+
+		auto ladders = ladder_range(*words, source, target, std::move(positions));
+		return detail::copy_ladders(ladders);
+	}
+
+	auto source_tree_cache::stats() const -> cache_stats {
+		return trees_.stats();
+	}
+
+	auto source_tree_cache::clear() -> void {
+		trees_.clear();
+	}
+} // namespace word_ladder
@@ -0,0 +1,297 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/mapped_file.hpp>
+#include <comp6771/word_graph.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+
+namespace word_ladder {
+	namespace {
+		// Snapshot layout: a header, one table entry per word length (including the unused length
+		// zero), then each length's words, offsets, neighbours and components. Version 2 added the
+		// components. The writer starts every section on an 8-byte boundary so the arrays can be
+		// used in place; the loader rejects any array that isn't aligned for its elements.
+		constexpr auto snapshot_magic = std::array<char, 8>{'W', 'L', 'G', 'R', 'A', 'P', 'H', '\0'};
+		constexpr auto snapshot_version = std::uint32_t{2};
+		constexpr auto snapshot_byte_order = std::uint32_t{0x01020304};
+
+		struct snapshot_header {
+			std::array<char, 8> magic;
+			std::uint32_t version;
+			std::uint32_t byte_order;
+			std::uint64_t partition_count;
+		};
+
+		struct snapshot_partition {
+			std::uint64_t word_count;
+			std::uint64_t edge_count;
+			std::uint64_t words_offset;
+			std::uint64_t offsets_offset;
+			std::uint64_t neighbors_offset;
+			std::uint64_t components_offset;
+		};
+
+		auto align(std::uint64_t offset) -> std::uint64_t {
+			return (offset + 7) & ~std::uint64_t{7};
+		}
+
+		// Owns the arrays of a graph built in memory
+		struct built_graph {
+			std::vector<std::string> words;
+			std::vector<std::vector<std::uint32_t>> offsets;
+			std::vector<std::vector<word_graph::word_id>> neighbors;
+			std::vector<std::vector<word_graph::word_id>> components;
+		};
+	} // namespace
+
+	word_graph::word_graph(std::unordered_set<std::string> const& lexicon)
+	: word_graph(neighbor_index(lexicon)) {}
+
+	word_graph::word_graph(lexicon const& words)
+	: word_graph(neighbor_index(words)) {}
+
+	word_graph::word_graph(neighbor_index const& index) {
+		auto const count = index.partitions_.size();
+		auto built = std::make_shared<built_graph>();
+		built->words.resize(count);
+		built->offsets.resize(count);
+		built->neighbors.resize(count);
+		built->components.resize(count);
+		partitions_.resize(count);
+
+		for (auto length = std::size_t{1}; length < count; ++length) {
+			auto const& source = index.partitions_[length];
+			if (source.words.empty()) {
+				continue;
+			}
+
+			auto& words = built->words[length];
+			auto& offsets = built->offsets[length];
+			auto& neighbors = built->neighbors[length];
+			words = source.words;
+			offsets.reserve(source.size() + 1);
+			offsets.push_back(0);
+			for (auto id = std::size_t{0}; id < source.size(); ++id) {
+				auto const first = neighbors.size();
+				source.for_each_neighbor(source.word(id), [&neighbors](auto next) {
+					neighbors.push_back(next);
+				});
+				std::sort(neighbors.begin() + static_cast<std::ptrdiff_t>(first), neighbors.end());
+				offsets.push_back(static_cast<std::uint32_t>(neighbors.size()));
+			}
+			neighbors.shrink_to_fit();
+			built->components[length] = source.components;
+
+			auto& part = partitions_[length];
+			part.length_ = length;
+			part.words_ = words;
+			part.offsets_ = offsets;
+			part.neighbors_ = neighbors;
+			part.components_ = built->components[length];
+		}
+		storage_ = std::move(built);
+	}
+
+	auto word_graph::words_of_length(std::size_t length) const -> partition const* {
+		if (length == 0 or length >= partitions_.size() or partitions_[length].words_.empty()) {
+			return nullptr;
+		}
+		return &partitions_[length];
+	}
+
+	auto save_word_graph(word_graph const& graph, std::string const& path) -> void {
+		auto out = std::ofstream(path.data(), std::ios::binary | std::ios::trunc);
+		if (not out) {
+			throw std::runtime_error("Unable to open file.");
+		}
+
+		auto const count = graph.partitions_.size();
+		auto header = snapshot_header{snapshot_magic, snapshot_version, snapshot_byte_order, count};
+		auto table = std::vector<snapshot_partition>(count);
+		auto offset = align(sizeof(header) + count * sizeof(snapshot_partition));
+		for (auto length = std::size_t{0}; length < count; ++length) {
+			auto const& part = graph.partitions_[length];
+			auto& entry = table[length];
+			entry.word_count = part.words_.empty() ? 0 : part.size();
+			entry.edge_count = part.neighbors_.size();
+			entry.words_offset = offset;
+			offset = align(offset + part.words_.size());
+			entry.offsets_offset = offset;
+			offset = align(offset + part.offsets_.size_bytes());
+			entry.neighbors_offset = offset;
+			offset = align(offset + part.neighbors_.size_bytes());
+			entry.components_offset = offset;
+			offset = align(offset + part.components_.size_bytes());
+		}
+
+		auto written = std::uint64_t{0};
+		auto const write = [&out, &written](void const* data, std::uint64_t size) {
+			out.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+			written += size;
+		};
+		auto const pad = [&write, &written] {
+			static constexpr auto zeros = std::array<char, 8>{};
+			write(zeros.data(), align(written) - written);
+		};
+
+		write(&header, sizeof(header));
+		write(table.data(), table.size() * sizeof(snapshot_partition));
+		pad();
+		std::for_each(graph.partitions_.begin(), graph.partitions_.end(), [&](auto const& part) {
+			write(part.words_.data(), part.words_.size());
+			pad();
+			write(part.offsets_.data(), part.offsets_.size_bytes());
+			pad();
+			write(part.neighbors_.data(), part.neighbors_.size_bytes());
+			pad();
+			write(part.components_.data(), part.components_.size_bytes());
+			pad();
+		});
+
+		if (not out) {
+			throw std::runtime_error("I/O error while writing");
+		}
+	}
+
+	auto map_word_graph(std::string const& path) -> word_graph {
+		auto file = map_file(path);
+		auto const contents = file.contents;
+
+		auto header = snapshot_header{};
+		if (contents.size() < sizeof(header)) {
+			throw std::runtime_error("Not a word graph snapshot.");
+		}
+		std::memcpy(&header, contents.data(), sizeof(header));
+		if (header.magic != snapshot_magic) {
+			throw std::runtime_error("Not a word graph snapshot.");
+		}
+		if (header.version != snapshot_version or header.byte_order != snapshot_byte_order) {
+			throw std::runtime_error("Unsupported word graph snapshot version or byte order.");
+		}
+
+		auto const count = header.partition_count;
+		if (count > (contents.size() - sizeof(header)) / sizeof(snapshot_partition)) {
+			throw std::runtime_error("Truncated word graph snapshot.");
+		}
+		auto table = std::vector<snapshot_partition>(count);
+		std::memcpy(table.data(), contents.data() + sizeof(header), count * sizeof(snapshot_partition));
+
+		// Every array must lie inside the file; a section that runs past the end means the file
+		// was cut short
+		auto const section = [&contents](std::uint64_t offset, std::uint64_t size) {
+			if (offset > contents.size() or size > contents.size() - offset) {
+				throw std::runtime_error("Truncated word graph snapshot.");
+			}
+			return contents.data() + offset;
+		};
+
+		// The offsets, neighbours and components are used in place as arrays of 32-bit integers
+		auto const id_section = [&section](std::uint64_t offset, std::uint64_t size) {
+			if (offset % alignof(word_graph::word_id) != 0) {
+				throw std::runtime_error("Corrupt word graph snapshot.");
+			}
+			return section(offset, size);
+		};
+
+		// Sizes are checked before they are multiplied, so a huge count can't wrap around to a
+		// section that looks like it fits
+		auto const bytes = [](std::uint64_t n, std::uint64_t size) {
+			if (n > std::numeric_limits<std::uint64_t>::max() / size) {
+				throw std::runtime_error("Corrupt word graph snapshot.");
+			}
+			return n * size;
+		};
+
+		auto graph = word_graph{};
+		graph.partitions_.resize(count);
+		for (auto length = std::size_t{1}; length < count; ++length) {
+			auto const& entry = table[length];
+			if (entry.word_count == 0) {
+				continue;
+			}
+			// Ids and offsets are 32 bits wide
+			if (entry.word_count >= std::numeric_limits<word_graph::word_id>::max()
+			    or entry.edge_count > std::numeric_limits<std::uint32_t>::max())
+			{
+				throw std::runtime_error("Corrupt word graph snapshot.");
+			}
+
+			auto const* const words = section(entry.words_offset, bytes(entry.word_count, length));
+			auto const* const offsets =
+			   id_section(entry.offsets_offset, bytes(entry.word_count + 1, sizeof(std::uint32_t)));
+			auto const* const neighbors =
+			   id_section(entry.neighbors_offset, bytes(entry.edge_count, sizeof(word_graph::word_id)));
+			auto const* const components =
+			   id_section(entry.components_offset, bytes(entry.word_count, sizeof(word_graph::word_id)));
+
+			auto& part = graph.partitions_[length];
+			part.length_ = length;
+			part.words_ = std::string_view(words, entry.word_count * length);
+			part.offsets_ = std::span(reinterpret_cast<std::uint32_t const*>(offsets),
+			                          entry.word_count + 1);
+			part.neighbors_ = std::span(reinterpret_cast<word_graph::word_id const*>(neighbors),
+			                            entry.edge_count);
+			part.components_ = std::span(reinterpret_cast<word_graph::word_id const*>(components),
+			                             entry.word_count);
+			// One pass over the arrays, so no id read from the file can index past the words of
+			// its length, and find() can binary search words that are strictly increasing
+			auto const word_count = entry.word_count;
+			auto const in_range = [word_count](word_graph::word_id id) { return id < word_count; };
+			auto const ids =
+			   std::views::iota(word_graph::word_id{1}, static_cast<word_graph::word_id>(word_count));
+			auto const increasing = std::ranges::all_of(ids, [&part](word_graph::word_id id) {
+				return part.word(id - 1) < part.word(id);
+			});
+			if (!increasing or part.offsets_.front() != 0 or part.offsets_.back() != entry.edge_count
+			    or !std::is_sorted(part.offsets_.begin(), part.offsets_.end())
+			    or !std::all_of(part.neighbors_.begin(), part.neighbors_.end(), in_range)
+			    or !std::all_of(part.components_.begin(), part.components_.end(), in_range))
+			{
+				throw std::runtime_error("Corrupt word graph snapshot.");
+			}
+		}
+		graph.storage_ = std::move(file.storage);
+		return graph;
+	}
+
+	auto word_graph::partition::length() const -> std::size_t {
+		return length_;
+	}
+
+	auto word_graph::partition::size() const -> std::size_t {
+		return offsets_.size() - 1;
+	}
+
+	auto word_graph::partition::word(word_id id) const -> std::string_view {
+		return words_.substr(id * length_, length_);
+	}
+
+	auto word_graph::partition::find(std::string_view target) const -> std::optional<word_id> {
+		auto const ids = std::views::iota(word_id{0}, static_cast<word_id>(size()));
+		auto const found =
+		   std::ranges::lower_bound(ids, target, {}, [this](auto id) { return word(id); });
+		if (found == ids.end() or word(*found) != target) {
+			return std::nullopt;
+		}
+		return *found;
+	}
+
+	auto word_graph::partition::neighbors(word_id id) const -> std::span<word_id const> {
+		return neighbors_.subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+	}
+
+	auto word_graph::partition::component(word_id id) const -> word_id {
+		return components_[id];
+	}
+
+	auto word_graph::partition::connected(word_id from, word_id to) const -> bool {
+		return components_[from] == components_[to];
+	}
+} // namespace word_ladder
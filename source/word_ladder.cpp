@@ -1,5 +1,23 @@
 #include <comp6771/word_ladder.hpp>
+
+#include "graph_search.hpp"
+
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 
 template<typename T>
 void print_vectors(std::vector<T> vec) {
@@ -27,93 +45,1254 @@ void print_collection(const T& collection){
 
 
 namespace word_ladder {
+	namespace {
+		// Every word reached by a search, mapped to the words one step closer to `from` that lead to
+		// it. A word is stored once no matter how many ladders pass through it. Keys and values view
+		// words owned by the caller's lexicon (or the query itself), so nothing is copied until the
+		// ladders are built. The map and its lists live in the query's arena.
+		using parent_map =
+		   std::pmr::unordered_map<std::string_view, std::pmr::vector<std::string_view>>;
 
-	// Helper lambda
-	// Finds if a two words are a "step"
-	[[nodiscard]] auto generate(std::string const& from,
-	                            std::string const& to,
-	                            std::unordered_set<std::string> const& lexicon)
-	   -> std::vector<std::vector<std::string>> {
-		(void)from;
-		(void)to;
-		(void)lexicon;
+		// Per-query scratch is served from this much stack before an arena goes to the heap
+		constexpr auto arena_stack_bytes = std::size_t{16384};
+
+		// Adds the time from its construction to its destruction to a phase's total
+		struct phase_timer {
+			std::chrono::nanoseconds& total;
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+			explicit phase_timer(std::chrono::nanoseconds& phase)
+			: total(phase) {}
+			phase_timer(phase_timer const&) = delete;
+			auto operator=(phase_timer const&) -> phase_timer& = delete;
+			~phase_timer() {
+				total += std::chrono::steady_clock::now() - start;
+			}
+		};
+
+		// Adds what a query does to a search_stats. With `Record` false it holds nothing and every
+		// call compiles away, so a query nobody is measuring pays nothing for being measurable.
+		template<bool Record>
+		struct recorder {
+			search_stats* stats = nullptr;
+
+			auto count(std::uint64_t search_stats::*counter, std::uint64_t n = 1) const -> void {
+				if constexpr (Record) {
+					stats->*counter += n;
+				}
+			}
+
+			auto peak(std::uint64_t search_stats::*counter, std::uint64_t n) const -> void {
+				if constexpr (Record) {
+					stats->*counter = std::max(stats->*counter, n);
+				}
+			}
+
+			// Returns f(), adding the time it took to `phase`
+			template<typename F>
+			auto time(std::chrono::nanoseconds search_stats::*phase, F const& f) const {
+				if constexpr (Record) {
+					auto const timer = phase_timer(stats->*phase);
+					return f();
+				}
+				else {
+					return f();
+				}
+			}
+		};
+
+		// Calls `f` with a recorder for `stats`, or with one that records nothing if it is null
+		template<typename F>
+		auto with_recorder(search_stats* stats, F const& f) {
+			if (stats == nullptr) {
+				return f(recorder<false>{});
+			}
+			return f(recorder<true>{stats});
+		}
+
+		// Calls `f` with `arena`, or, if it is null, with an arena that starts on this stack frame.
+		// The stack buffer is only set aside when it is used, and is never zeroed.
+		template<typename F>
+		auto with_arena(std::pmr::memory_resource* arena, F const& f) {
+			if (arena != nullptr) {
+				return f(arena);
+			}
+			std::byte buffer[arena_stack_bytes];
+			auto local = std::pmr::monotonic_buffer_resource(buffer, sizeof(buffer));
+			return f(&local);
+		}
+
+		// The text of a word, whichever way a search stores it
+		auto word_string(std::string_view word) -> std::string {
+			return std::string(word);
+		}
+
+		// A word as a packed_lexicon key. It is never 0.
+		struct packed_word {
+			packed_lexicon::key bits = 0;
+
+			friend auto operator==(packed_word, packed_word) -> bool = default;
+		};
+
+		struct packed_word_hash {
+			[[nodiscard]] auto operator()(packed_word word) const -> std::size_t {
+				auto const hash = word.bits * 0x9E3779B97F4A7C15U;
+				return static_cast<std::size_t>(hash ^ (hash >> 32U));
+			}
+		};
+
+		auto word_string(packed_word word) -> std::string {
+			return packed_lexicon::unpack(word.bits);
+		}
+
+		// A set of packed words in one flat array of keys, probed linearly, which is never more than
+		// half full. The words are also kept in the order they were added, so walking the set walks
+		// a plain vector. Both arrays come from an arena, which is never asked to free anything.
+		class flat_word_set {
+		public:
+			explicit flat_word_set(std::pmr::memory_resource* arena)
+			: words_(arena)
+			, slots_(arena) {}
+
+			// Like the hash set's bucket count, `capacity` is how many words fit before it grows
+			flat_word_set(std::initializer_list<packed_word> words,
+			              std::size_t capacity,
+			              std::pmr::memory_resource* arena)
+			: flat_word_set(arena) {
+				reserve(std::max(capacity, words.size()));
+				insert(words.begin(), words.end());
+			}
+
+			[[nodiscard]] auto contains(packed_word word) const -> bool {
+				return !slots_.empty() and slots_[find(word.bits)] == word.bits;
+			}
+
+			auto reserve(std::size_t capacity) -> void {
+				words_.reserve(capacity);
+				if (2 * capacity > slots_.size()) {
+					rehash(std::bit_ceil(2 * capacity));
+				}
+			}
+
+			auto insert(packed_word word) -> void {
+				if (2 * (words_.size() + 1) > slots_.size()) {
+					rehash(std::max(slots_.size() * 2, std::size_t{16}));
+				}
+				auto& slot = slots_[find(word.bits)];
+				if (slot != word.bits) {
+					slot = word.bits;
+					words_.push_back(word);
+				}
+			}
+
+			template<typename InputIt>
+			auto insert(InputIt first, InputIt last) -> void {
+				std::for_each(first, last, [this](packed_word word) { insert(word); });
+			}
+
+			[[nodiscard]] auto begin() const {
+				return words_.begin();
+			}
+
+			[[nodiscard]] auto end() const {
+				return words_.end();
+			}
+
+			[[nodiscard]] auto size() const -> std::size_t {
+				return words_.size();
+			}
+
+			[[nodiscard]] auto empty() const -> bool {
+				return words_.empty();
+			}
+
+		private:
+			// Returns the slot that holds `bits`, or the empty slot where it would go
+			[[nodiscard]] auto find(packed_lexicon::key bits) const -> std::size_t {
+				auto const mask = slots_.size() - 1;
+				auto i = static_cast<std::size_t>((bits * 0x9E3779B97F4A7C15U) >> shift_);
+				while (slots_[i] != 0 and slots_[i] != bits) {
+					i = (i + 1) & mask;
+				}
+				return i;
+			}
+
+			// Pre: `slots` is a power of two
+			auto rehash(std::size_t slots) -> void {
+				slots_.assign(slots, 0);
+				shift_ = 64U - static_cast<unsigned>(std::countr_zero(slots_.size()));
+				std::for_each(words_.begin(), words_.end(), [this](packed_word word) {
+					slots_[find(word.bits)] = word.bits;
+				});
+			}
+
+			std::pmr::vector<packed_word> words_;
+			std::pmr::vector<packed_lexicon::key> slots_;
+			unsigned shift_ = 64;
+		};
+
+		// The set a search keeps its words in: a hash set, or a flat_word_set for packed words
+		template<typename Word, typename Hash>
+		struct search_set {
+			using type = std::pmr::unordered_set<Word, Hash>;
+		};
+
+		template<typename Hash>
+		struct search_set<packed_word, Hash> {
+			using type = flat_word_set;
+		};
+
+		// A word of a neighbor_index or word_rows, with its id among the words of its length. Two
+		// words of one search are the same word exactly when their ids are equal.
+		struct indexed_word {
+			std::uint32_t id = 0;
+			std::string_view text;
+
+			friend auto operator==(indexed_word x, indexed_word y) -> bool {
+				return x.id == y.id;
+			}
+		};
+
+		struct indexed_word_hash {
+			[[nodiscard]] auto operator()(indexed_word word) const -> std::size_t {
+				return word.id;
+			}
+		};
+
+		auto word_string(indexed_word word) -> std::string {
+			return std::string(word.text);
+		}
+
+		using indexed_parent_map =
+		   std::pmr::unordered_map<indexed_word, std::pmr::vector<indexed_word>, indexed_word_hash>;
 
-		// Creating new lexicon with words of the same length as query words
-		auto words = std::unordered_set<std::string>{};
-		std::copy_if(lexicon.begin(),
-		             lexicon.end(),
-		             std::inserter(words, words.begin()),
-		             [&from](std::string s) { return (s.length() == from.length()); });
+		// The indexed words a search has reached, each marked with the search's stamp in an array
+		// indexed by id. A new search takes a new stamp instead of clearing the array, which only
+		// grows to the most words of any length searched with it.
+		class reached_words {
+		public:
+			// Starts a search whose words have ids below `count`, with nothing reached
+			auto reset(std::size_t count) -> void {
+				if (stamps_.size() < count) {
+					stamps_.assign(count, 0);
+					stamp_ = 1;
+				}
+				else if (++stamp_ == 0) {
+					std::fill(stamps_.begin(), stamps_.end(), 0);
+					stamp_ = 1;
+				}
+			}
 
-		// Variables for algorithm
+			[[nodiscard]] auto contains(indexed_word word) const -> bool {
+				return stamps_[word.id] == stamp_;
+			}
 
-		auto alp = std::vector<char> {'a','b','c','d','e','f',
-		'g','h','i','j','k','l','m','n','o','p',
-		'q','r','s','t','u','v','w','x','y','z'};
+			template<typename InputIt>
+			auto insert(InputIt first, InputIt last) -> void {
+				std::for_each(first, last, [this](indexed_word word) { stamps_[word.id] = stamp_; });
+			}
 
-		std::unordered_set<std::string> words_checked {};
-		std::vector<std::string> words_to_check {};
-		std::vector<std::string> layer_words {from};
-		std::unordered_set<std::string> layer_words_found {from};
-		std::vector<std::vector<std::string>> ladders {};
+		private:
+			std::vector<std::uint32_t> stamps_;
+			std::uint32_t stamp_ = 0;
+		};
 
-		std::vector<std::vector<std::string>> intersections {};
+		// Grows a frontier from each end of the query, always expanding whichever is smaller by one
+		// layer, until a layer reaches a word in the other frontier. `for_each_step(word, f)` must call
+		// `f` with every word of the lexicon one letter away from `word`. Returns whether the two
+		// frontiers met; if they did, `parents` holds every shortest ladder. Every set is allocated
+		// from the same arena as `parents`, and holds the same type of word.
+		//
+		// `words_checked` holds every word reached so far, starting with `from` and `to`. It need
+		// only have contains(word) and insert(first, last), so it can be a set or an array of marks.
+		template<typename ParentMap, typename Visited, typename StepFn, typename Recorder>
+		auto search(typename ParentMap::key_type const& from,
+		            typename ParentMap::key_type const& to,
+		            ParentMap& parents,
+		            Visited& words_checked,
+		            StepFn const& for_each_step,
+		            Recorder const& record) -> bool {
+			using word_type = typename ParentMap::key_type;
+			using word_set = typename search_set<word_type, typename ParentMap::hasher>::type;
 
+			auto* const arena = parents.get_allocator().resource();
+			auto front = word_set({from}, 0, arena);
+			auto back = word_set({to}, 0, arena);
+			auto forwards = true;
+			auto met = false;
 
-		std::queue<std::vector<std::string>> q {};
-		q.push(std::vector<std::string> {from});
+			while (!met and !front.empty() and !back.empty()) {
+				if (front.size() > back.size()) {
+					std::swap(front, back);
+					forwards = !forwards;
+				}
+				record.count(&search_stats::layers);
+				record.count(&search_stats::dequeued, front.size());
+				record.peak(&search_stats::peak_frontier, front.size());
 
+				// Records that `word` (in the frontier being grown) and `next` are one step apart
+				auto const link = [&](word_type const& word, word_type const& next) {
+					if (forwards) {
+						parents[next].push_back(word);
+					}
+					else {
+						parents[word].push_back(next);
+					}
+				};
 
-		size_t layer = 0;
-		while (!q.empty()) {
-			auto lad = q.front();
-			q.pop();
+				auto layer_words = word_set(arena);
+				std::for_each(front.begin(), front.end(), [&](word_type const& word) {
+					for_each_step(word, [&](word_type const& next) {
+						// Each step is looked up once, whether it meets the other frontier or not
+						record.count(&search_stats::probes);
+						if (back.contains(next)) {
+							record.count(&search_stats::intersections);
+							met = true;
+							link(word, next);
+							return;
+						}
+						if (!words_checked.contains(next)) {
+							layer_words.insert(next);
+							link(word, next);
+						}
+					});
+				});
 
-			if (layer != lad.size()) {
 				words_checked.insert(layer_words.begin(), layer_words.end());
-				layer_words.clear();
-				layer_words_found.clear();
-				++layer;
+				front = std::move(layer_words);
 			}
+			return met;
+		}
+
+		// As above, keeping the words reached in a set allocated from the same arena as `parents`
+		template<typename ParentMap, typename StepFn, typename Recorder>
+		auto search(typename ParentMap::key_type const& from,
+		            typename ParentMap::key_type const& to,
+		            ParentMap& parents,
+		            StepFn const& for_each_step,
+		            Recorder const& record) -> bool {
+			using word_set = typename search_set<typename ParentMap::key_type,
+			                                     typename ParentMap::hasher>::type;
+			auto words_checked = word_set({from, to}, 0, parents.get_allocator().resource());
+			return search(from, to, parents, words_checked, for_each_step, record);
+		}
+
+		// Builds every ladder by walking the predecessor lists back from `to`. Words near `to` may
+		// have been reached without ever leading back to `from`; those are remembered so each dead
+		// end is only explored once. The walk's own scratch comes from `arena`.
+		template<typename ParentMap, typename Recorder>
+		auto walk_ladders(typename ParentMap::key_type const& from,
+		                  typename ParentMap::key_type const& to,
+		                  ParentMap const& parents,
+		                  std::pmr::memory_resource* arena,
+		                  Recorder const& record) -> std::vector<std::vector<std::string>> {
+			using word_type = typename ParentMap::key_type;
+
+			auto word_ladders = std::vector<std::vector<std::string>>{};
+			auto ladder = std::pmr::vector<word_type>({to}, arena);
+			auto dead_ends = typename search_set<word_type, typename ParentMap::hasher>::type(arena);
+
+			auto const walk = [&](auto const& self, word_type const& word) -> bool {
+				if (word == from) {
+					auto& copy = word_ladders.emplace_back();
+					copy.reserve(ladder.size());
+					std::transform(ladder.rbegin(),
+					               ladder.rend(),
+					               std::back_inserter(copy),
+					               [](word_type const& w) { return word_string(w); });
+					return true;
+				}
+				auto const word_parents = parents.find(word);
+				if (word_parents == parents.end() or dead_ends.contains(word)) {
+					return false;
+				}
+
+				auto found = false;
+				for (auto const& parent : word_parents->second) {
+					ladder.push_back(parent);
+					found = self(self, parent) or found;
+					ladder.pop_back();
+				}
+				if (!found) {
+					dead_ends.insert(word);
+				}
+				return found;
+			};
+			record.time(&search_stats::rebuild_time, [&] { walk(walk, to); });
+			record.time(&search_stats::sort_time,
+			            [&] { std::sort(word_ladders.begin(), word_ladders.end()); });
+			return word_ladders;
+		}
 
-			if (lad.back() == to) {
-				return rebuild_ladders(lad, intersections);
+		using detail::copy_ladders;
+		using detail::find_query;
+		using detail::ladder_positions;
+		using detail::search_from;
+		using detail::source_search;
+		using detail::unreached;
+		using detail::word_id;
+
+		// Distances found by a bidirectional search over one partition of a word_graph, kept in
+		// the caller's buffers. Each word is reached from at most one end.
+		struct graph_search {
+			search_buffers const& buffers;
+			std::uint32_t length = unreached;
+
+			// Returns how many steps from the source `id` sits on any shortest ladder through it,
+			// or `unreached` if the search never got to it.
+			[[nodiscard]] auto position(word_id id) const -> std::uint32_t {
+				if (buffers.from_source[id] != unreached) {
+					return buffers.from_source[id];
+				}
+				if (buffers.to_target[id] != unreached) {
+					return length - buffers.to_target[id];
+				}
+				return unreached;
 			}
+		};
+
+		// The same frontier-balancing search as above, run over word ids. Only distances are kept:
+		// a word's predecessors are exactly its neighbours one position closer to the source, so
+		// they can be recovered from the adjacency arrays without being stored.
+		auto search(word_graph::partition const& words,
+		            word_id source,
+		            word_id target,
+		            search_buffers& buffers) -> graph_search {
+			auto found = graph_search{buffers};
+			buffers.from_source.reset(words.size());
+			buffers.to_target.reset(words.size());
+			buffers.from_source.set(source, 0);
+			buffers.to_target.set(target, 0);
+
+			auto& front = buffers.front;
+			auto& back = buffers.back;
+			auto& layer_words = buffers.layer;
+			front.assign(1, source);
+			back.assign(1, target);
+			auto* front_distance = &buffers.from_source;
+			auto* back_distance = &buffers.to_target;
+			while (found.length == unreached and !front.empty() and !back.empty()) {
+				if (front.size() > back.size()) {
+					std::swap(front, back);
+					std::swap(front_distance, back_distance);
+				}
 
-			std::for_each(alp.begin(), alp.end(), [&](auto& c) {
-				auto from_copy = lad.back();;
-				std::for_each(from_copy.begin(), from_copy.end(), [&](auto& fc){
-					char tmp = fc;
-					fc = c;
-					if (layer_words_found.find(from_copy) != words_checked.end()) {
-						auto lad_copy = lad;
-						lad_copy.push_back(from_copy);
-						intersections.push_back(lad_copy);
-					} else if (words_checked.find(from_copy) == words_checked.end()) {
-						words_to_check.push_back(from_copy);
+				layer_words.clear();
+				for (auto const word : front) {
+					auto const distance = (*front_distance)[word] + 1;
+					for (auto const next : words.neighbors(word)) {
+						if ((*back_distance)[next] != unreached) {
+							found.length = distance + (*back_distance)[next];
+						}
+						else if ((*front_distance)[next] == unreached) {
+							front_distance->set(next, distance);
+							layer_words.push_back(next);
+						}
 					}
+				}
+				std::swap(front, layer_words);
+			}
+			return found;
+		}
+
+		// Layers with fewer words than this per thread are cheaper to expand on one thread than to
+		// hand out
+		constexpr auto words_per_thread = std::size_t{64};
+
+		// The bidirectional search again, with each layer's frontier split between `threads`
+		// threads. A word is claimed by setting its bit in a shared atomic bitset, so exactly one
+		// thread records its distance and adds it to the next layer. Each thread gathers its share
+		// of the next layer on its own, and the shares are then copied side by side at offsets
+		// given by a prefix sum of their sizes. Distances are the same as the sequential search
+		// finds, so the ladders are too.
+		//
+		// The workers are started once per search, not once per layer. A barrier lets them all go
+		// once the calling thread has set a layer up, and holds them again until every share of it
+		// is done, so a deep search pays for thread start-up only once.
+		auto parallel_search(word_graph::partition const& words,
+		                     word_id source,
+		                     word_id target,
+		                     search_buffers& buffers,
+		                     std::size_t threads) -> graph_search {
+			auto found = graph_search{buffers};
+			buffers.from_source.reset(words.size());
+			buffers.to_target.reset(words.size());
+			buffers.from_source.set(source, 0);
+			buffers.to_target.set(target, 0);
+
+			auto reached = std::vector<std::atomic<std::uint64_t>>((words.size() + 63) / 64);
+			auto const claim = [&reached](word_id word) {
+				auto const bit = std::uint64_t{1} << (word % 64);
+				auto& block = reached[word / 64];
+				return (block.load(std::memory_order_relaxed) & bit) == 0
+				       and (block.fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+			};
+			claim(source);
+			claim(target);
+
+			auto& front = buffers.front;
+			auto& back = buffers.back;
+			auto& layer_words = buffers.layer;
+			front.assign(1, source);
+			back.assign(1, target);
+			auto* front_distance = &buffers.from_source;
+			auto* back_distance = &buffers.to_target;
+			auto shares = std::vector<std::vector<word_id>>(threads);
+			auto offsets = std::vector<std::size_t>(threads + 1);
+			auto length = std::atomic<std::uint32_t>{unreached};
+
+			// Expands front[first, last) into `share`
+			auto const expand = [&](std::size_t first, std::size_t last, std::vector<word_id>& share) {
+				share.clear();
+				for (auto i = first; i < last; ++i) {
+					auto const word = front[i];
+					auto const distance = (*front_distance)[word] + 1;
+					for (auto const next : words.neighbors(word)) {
+						if ((*back_distance)[next] != unreached) {
+							length.store(distance + (*back_distance)[next], std::memory_order_relaxed);
+						}
+						else if (claim(next)) {
+							front_distance->set(next, distance);
+							share.push_back(next);
+						}
+					}
+				}
+			};
+
+			// Set by the calling thread before each layer; read by the workers only after the
+			// barrier that starts it
+			auto used = std::size_t{1};
+			auto chunk = std::size_t{0};
+			auto stopping = false;
+			auto const range = [&](std::size_t thread) {
+				if (thread >= used) {
+					return std::pair(front.size(), front.size());
+				}
+				return std::pair(std::min(thread * chunk, front.size()),
+				                 std::min((thread + 1) * chunk, front.size()));
+			};
+
+			// The workers start with the first layer wide enough to share, so a search whose
+			// frontiers stay narrow never starts a thread
+			auto layer = std::optional<std::barrier<>>{};
+			auto workers = std::vector<std::jthread>{};
+			auto const start_workers = [&] {
+				layer.emplace(static_cast<std::ptrdiff_t>(threads));
+				for (auto thread = std::size_t{1}; thread < threads; ++thread) {
+					workers.emplace_back([&, thread] {
+						while (true) {
+							layer->arrive_and_wait();
+							if (stopping) {
+								return;
+							}
+							auto const [first, last] = range(thread);
+							expand(first, last, shares[thread]);
+							layer->arrive_and_wait();
+						}
+					});
+				}
+			};
+
+			while (length.load(std::memory_order_relaxed) == unreached and !front.empty()
+			       and !back.empty())
+			{
+				if (front.size() > back.size()) {
+					std::swap(front, back);
+					std::swap(front_distance, back_distance);
+				}
+
+				used = std::clamp(front.size() / words_per_thread, std::size_t{1}, threads);
+				chunk = (front.size() + used - 1) / used;
+				if (used > 1 and workers.empty()) {
+					start_workers();
+				}
+				if (!workers.empty()) {
+					layer->arrive_and_wait();
+				}
+				auto const [first, last] = range(0);
+				expand(first, last, shares[0]);
+				if (!workers.empty()) {
+					layer->arrive_and_wait();
+				}
+
+				offsets[0] = 0;
+				for (auto thread = std::size_t{0}; thread < used; ++thread) {
+					offsets[thread + 1] = offsets[thread] + shares[thread].size();
+				}
+				layer_words.resize(offsets[used]);
+				for (auto thread = std::size_t{0}; thread < used; ++thread) {
+					std::copy(shares[thread].begin(),
+					          shares[thread].end(),
+					          layer_words.begin() + static_cast<std::ptrdiff_t>(offsets[thread]));
+				}
+				std::swap(front, layer_words);
+			}
+			if (!workers.empty()) {
+				stopping = true;
+				layer->arrive_and_wait();
+				workers.clear();
+			}
+			found.length = length.load(std::memory_order_relaxed);
+			return found;
+		}
+
+		// One range per thread for generate() and find_ladders() to reset for each query, so a
+		// query reuses the last one's buffers and starts its search with stamps instead of fills
+		auto thread_ladders() -> ladder_range& {
+			thread_local auto ladders = ladder_range{};
+			return ladders;
+		}
+
+		// Searches `words`, which holds every word of the query's length, by trying each letter in
+		// `letters` at each position of a word and probing the set for the result
+		template<typename WordSet, typename Recorder>
+		auto generate_by_probing(std::string const& from,
+		                         std::string const& to,
+		                         WordSet const& words,
+		                         std::string_view letters,
+		                         std::pmr::memory_resource* arena,
+		                         Recorder const& record) -> std::vector<std::vector<std::string>> {
+			if (from == to) {
+				return {{from}};
+			}
+			if (!words.contains(to)) {
+				return {};
+			}
+
+			// One buffer is reused for every word expanded
+			auto from_copy = std::pmr::string(arena);
+			auto const for_each_step = [&](std::string_view word, auto const& f) {
+				from_copy.assign(word);
+				std::for_each(from_copy.begin(), from_copy.end(), [&](auto& fc) {
+					char const tmp = fc;
+					std::for_each(letters.begin(), letters.end(), [&](auto c) {
+						if (c == tmp) {
+							return;
+						}
+						fc = c;
+						record.count(&search_stats::candidates);
+						record.count(&search_stats::probes);
+						if (auto const found = words.find(std::string_view(from_copy));
+						    found != words.end()) {
+							record.count(&search_stats::hits);
+							f(*found);
+						}
+					});
 					fc = tmp;
 				});
+			};
+
+			auto parents = parent_map(arena);
+			auto const met = record.time(&search_stats::search_time,
+			                             [&] { return search(from, to, parents, for_each_step, record); });
+			if (!met) {
+				return {};
+			}
+			return walk_ladders<parent_map>(from, to, parents, arena, record);
+		}
+
+		// Returns whether the words of `length` with ids `from` and `to` may have a ladder between
+		// them. A neighbor_index knows its components, but word_rows would have to search.
+		auto may_connect(neighbor_index const& index,
+		                 std::size_t length,
+		                 std::uint32_t from,
+		                 std::uint32_t to) -> bool {
+			return index.connected(length, from, to);
+		}
+
+		auto may_connect(word_rows const&, std::size_t, std::uint32_t, std::uint32_t) -> bool {
+			return true;
+		}
+
+		// Searches with `neighbors.for_each_neighbor_id(word, f)` to find each word's steps, for any
+		// structure that yields only words of the lexicon, with their ids (a neighbor_index, or
+		// word_rows). The words reached are marked by id in an array kept for each thread, rather
+		// than kept in a set.
+		template<typename Neighbors>
+		auto generate_by_scanning(std::string const& from,
+		                          std::string const& to,
+		                          Neighbors const& neighbors,
+		                          std::pmr::memory_resource* arena,
+		                          search_stats* stats) -> std::vector<std::vector<std::string>> {
+			if (from == to) {
+				return {{from}};
+			}
+			auto const target_id = neighbors.find(to);
+			if (from.size() != to.size() or !target_id) {
+				return {};
+			}
+
+			// Words in different components have no ladder, so there is nothing to search for
+			auto const source_id = neighbors.find(from);
+			if (source_id and !may_connect(neighbors, from.size(), *source_id, *target_id)) {
+				return {};
+			}
+
+			// A source that is not a word takes the id after the last word's
+			auto const count = neighbors.word_count(from.size());
+			auto const source =
+			   indexed_word{source_id.value_or(static_cast<std::uint32_t>(count)), from};
+			auto const target = indexed_word{*target_id, to};
+			thread_local auto reached = reached_words{};
+			reached.reset(count + 1);
+			auto const ends = std::array{source, target};
+			reached.insert(ends.begin(), ends.end());
+
+			auto const run = [&](std::pmr::memory_resource* scratch, auto const& record)
+			   -> std::vector<std::vector<std::string>> {
+				// Every word yielded is a word of the lexicon, found without a probe
+				auto const for_each_step = [&](indexed_word word, auto const& f) {
+					auto const step = [&record, &f](std::uint32_t id, std::string_view next) {
+						record.count(&search_stats::candidates);
+						record.count(&search_stats::hits);
+						f(indexed_word{id, next});
+					};
+					neighbors.for_each_neighbor_id(word.text, step);
+				};
+
+				auto parents = indexed_parent_map(scratch);
+				auto const met = record.time(&search_stats::search_time, [&] {
+					return search(source, target, parents, reached, for_each_step, record);
+				});
+				if (!met) {
+					return {};
+				}
+				return walk_ladders<indexed_parent_map>(source, target, parents, scratch, record);
+			};
+			return with_arena(arena, [&](std::pmr::memory_resource* scratch) {
+				return with_recorder(stats, [&](auto const& record) { return run(scratch, record); });
+			});
+		}
+	} // namespace
+
+	namespace detail {
+		auto search_from(word_graph::partition const& words,
+		                 word_id source,
+		                 std::vector<word_id> const& targets) -> std::vector<std::uint32_t> {
+			auto from_source = std::vector<std::uint32_t>(words.size(), unreached);
+			from_source[source] = 0;
+			auto remaining = std::count_if(targets.begin(), targets.end(), [source](auto target) {
+				return target != source;
+			});
+
+			auto front = std::vector<word_id>{source};
+			auto layer_words = std::vector<word_id>{};
+			while ((targets.empty() or remaining > 0) and !front.empty()) {
+				layer_words.clear();
+				for (auto const word : front) {
+					auto const distance = from_source[word] + 1;
+					for (auto const next : words.neighbors(word)) {
+						if (from_source[next] == unreached) {
+							from_source[next] = distance;
+							layer_words.push_back(next);
+						}
+					}
+				}
+				std::swap(front, layer_words);
+				remaining = std::count_if(targets.begin(), targets.end(), [&from_source](auto target) {
+					return from_source[target] == unreached;
+				});
+			}
+			return from_source;
+		}
+
+		auto find_query(std::string const& from, std::string const& to, word_graph const& graph)
+		   -> std::optional<graph_query> {
+			auto const* const words = graph.words_of_length(from.size());
+			if (words == nullptr or from.size() != to.size()) {
+				return std::nullopt;
+			}
+			auto const source = words->find(from);
+			auto const target = words->find(to);
+			// Words in different components have no ladder, so there is nothing to search for
+			if (!source or !target or !words->connected(*source, *target)) {
+				return std::nullopt;
+			}
+			return graph_query{words, *source, *target};
+		}
+
+		auto copy_ladders(ladder_range& ladders) -> std::vector<std::vector<std::string>> {
+			auto word_ladders = std::vector<std::vector<std::string>>{};
+			std::ranges::transform(ladders, std::back_inserter(word_ladders), [](auto const& ladder) {
+				return std::vector<std::string>(ladder.begin(), ladder.end());
 			});
+			return word_ladders;
+		}
+	} // namespace detail
 
+	// Helper lambda
+	// Finds if a two words are a "step"
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            std::unordered_set<std::string> const& lexicon,
+	                            std::pmr::memory_resource* arena,
+	                            search_stats* stats) -> std::vector<std::vector<std::string>> {
+		return with_arena(arena, [&](std::pmr::memory_resource* scratch) {
+			// Creating new lexicon with words of the same length as query words
+			auto words = std::pmr::unordered_set<std::string_view>(scratch);
+			std::copy_if(lexicon.begin(),
+			             lexicon.end(),
+			             std::inserter(words, words.begin()),
+			             [&from](std::string const& s) { return (s.length() == from.length()); });
 
-			std::for_each(words_to_check.begin(), words_to_check.end(), [&](auto& s){
-				if (words.find(s) != words.end()) {
-					auto lad_copy = lad;
-					lad_copy.push_back(s);
-					q.push(lad_copy);
-					layer_words_found.insert(s);
-				} else {
-					words_checked.insert(s);
+			// Only letters that appear in a word of this length can ever produce a step
+			auto used = std::array<bool, 256>{};
+			std::for_each(words.begin(), words.end(), [&used](auto word) {
+				std::for_each(word.begin(), word.end(), [&used](unsigned char c) { used[c] = true; });
+			});
+			auto alp = std::pmr::string(scratch);
+			for (auto c = std::size_t{0}; c < used.size(); ++c) {
+				if (used[c]) {
+					alp.push_back(static_cast<char>(c));
 				}
+			}
+
+			return with_recorder(stats, [&](auto const& record) {
+				return generate_by_probing(from, to, words, alp, scratch, record);
 			});
+		});
+	}
 
-			layer_words.insert(layer_words.end(), words_to_check.begin(), words_to_check.end());
-			words_to_check.clear();
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              lexicon const& words,
+	              std::pmr::memory_resource* arena,
+	              search_stats* stats) -> std::vector<std::vector<std::string>> {
+		return with_arena(arena, [&](std::pmr::memory_resource* scratch) {
+			return with_recorder(stats, [&](auto const& record) {
+				return generate_by_probing(from,
+				                           to,
+				                           words.words_of_length(from.size()),
+				                           words.letters_of_length(from.size()),
+				                           scratch,
+				                           record);
+			});
+		});
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              neighbor_index const& index,
+	              std::pmr::memory_resource* arena,
+	              search_stats* stats) -> std::vector<std::vector<std::string>> {
+		return generate_by_scanning(from, to, index, arena, stats);
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              word_rows const& rows,
+	              std::pmr::memory_resource* arena,
+	              search_stats* stats) -> std::vector<std::vector<std::string>> {
+		return generate_by_scanning(from, to, rows, arena, stats);
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              packed_lexicon const& words,
+	              std::pmr::memory_resource* arena,
+	              search_stats* stats) -> std::vector<std::vector<std::string>> {
+		auto const length = from.size();
+		auto const source = packed_lexicon::pack(from);
+		if (!source or !words.packed(length)) {
+			return generate(from, to, words.words(), arena, stats);
+		}
+		if (from == to) {
+			return {{from}};
+		}
+		auto const target = packed_lexicon::pack(to);
+		if (to.size() != length or !target or !words.contains(*target, length)) {
+			return {};
+		}
+		auto const run = [&](std::pmr::memory_resource* scratch, auto const& record)
+		   -> std::vector<std::vector<std::string>> {
+			// Every other letter is tried at every position of a word of the lexicon
+			auto const tried = length * (words.letter_count(length) - 1);
+			auto const for_each_step = [&](packed_word word, auto const& f) {
+				record.count(&search_stats::candidates, tried);
+				record.count(&search_stats::probes, tried);
+				words.for_each_neighbor(word.bits, length, [&](packed_lexicon::key next) {
+					record.count(&search_stats::hits);
+					f(packed_word{next});
+				});
+			};
 
+			using word_parents =
+			   std::pmr::unordered_map<packed_word, std::pmr::vector<packed_word>, packed_word_hash>;
+			auto parents = word_parents(scratch);
+			auto const met = record.time(&search_stats::search_time, [&] {
+				return search(packed_word{*source}, packed_word{*target}, parents, for_each_step, record);
+			});
+			if (!met) {
+				return {};
+			}
+			return walk_ladders<word_parents>(packed_word{*source},
+			                                  packed_word{*target},
+			                                  parents,
+			                                  scratch,
+			                                  record);
 		};
+		return with_arena(arena, [&](std::pmr::memory_resource* scratch) {
+			return with_recorder(stats, [&](auto const& record) { return run(scratch, record); });
+		});
+	}
+
+	auto generate(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> std::vector<std::vector<std::string>> {
+		auto& ladders = thread_ladders();
+		ladders.reset(from, to, graph);
+		return copy_ladders(ladders);
+	}
+
+	auto search_distances::reset(std::size_t size) -> void {
+		// Stamps only need clearing when the words change or the stamp wraps around
+		if (entries_.size() != size or ++stamp_ == 0) {
+			entries_.assign(size, entry{});
+			stamp_ = 1;
+		}
+	}
+
+	ladder_range::ladder_range(std::string const& from,
+	                           std::string const& to,
+	                           word_graph const& graph) {
+		reset(from, to, graph);
+	}
+
+	auto ladder_range::reset(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> void {
+		// position_ keeps the last query's positions, for ladder_positions() to clear
+		from_ = from;
+		words_ = nullptr;
+		path_.clear();
+		ladder_.clear();
+		found_ = false;
+		done_ = true;
+		if (from == to) {
+			found_ = true;
+			return;
+		}
+		words_ = graph.words_of_length(from.size());
+		if (words_ == nullptr or from.size() != to.size()) {
+			return;
+		}
+		auto const source = words_->find(from);
+		auto const target = words_->find(to);
+		// Words in different components have no ladder, so there is nothing to search for
+		if (!source or !target or !words_->connected(*source, *target)) {
+			return;
+		}
+
+		auto const found = search(*words_, *source, *target, buffers_);
+		if (found.length == unreached) {
+			return;
+		}
+		source_ = *source;
+		target_ = *target;
+		ladder_positions(*words_, found, target_, position_, on_ladder_);
+		found_ = true;
+	}
+
+	auto ladder_range::begin() -> iterator {
+		path_.clear();
+		ladder_.clear();
+		done_ = !found_;
+		if (done_) {
+			return iterator(this);
+		}
+		if (words_ == nullptr) {
+			ladder_.push_back(from_);
+			return iterator(this);
+		}
 
-		return ladders;
+		path_.push_back({source_, 0});
+		ladder_.push_back(words_->word(source_));
+		advance();
+		return iterator(this);
+	}
+
+	auto ladder_range::end() const -> std::default_sentinel_t {
+		return std::default_sentinel;
+	}
+
+	auto ladder_range::advance() -> void {
+		while (!path_.empty()) {
+			auto& top = path_.back();
+			auto const neighbors = words_->neighbors(top.word);
+			auto const position = position_[top.word] + 1;
+			while (top.next < neighbors.size() and position_[neighbors[top.next]] != position) {
+				++top.next;
+			}
+			if (top.next == neighbors.size()) {
+				path_.pop_back();
+				ladder_.pop_back();
+				continue;
+			}
+
+			auto const next = neighbors[top.next++];
+			path_.push_back({next, 0});
+			ladder_.push_back(words_->word(next));
+			if (next == target_) {
+				return;
+			}
+		}
+		done_ = true;
+	}
+
+	auto ladder_range::iterator::operator*() const -> reference {
+		return range_->ladder_;
+	}
+
+	auto ladder_range::iterator::operator->() const -> pointer {
+		return &range_->ladder_;
+	}
+
+	auto ladder_range::iterator::operator++() -> iterator& {
+		range_->advance();
+		return *this;
+	}
+
+	auto ladder_range::iterator::operator++(int) -> void {
+		++*this;
+	}
+
+	auto ladder_range::iterator::at_end() const -> bool {
+		return range_ == nullptr or range_->done_;
+	}
+
+	auto enumerate_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_range {
+		return ladder_range(from, to, graph);
+	}
+
+	auto ladder_set::size() const -> std::size_t {
+		return length_ == 0 ? 0 : ids_.size() / length_;
+	}
+
+	auto ladder_set::empty() const -> bool {
+		return ids_.empty();
+	}
+
+	auto ladder_set::ladder_length() const -> std::size_t {
+		return length_;
+	}
+
+	auto ladder_set::operator[](std::size_t i) const -> std::span<word_id const> {
+		return std::span<word_id const>(ids_).subspan(i * length_, length_);
+	}
+
+	auto ladder_set::word(word_id id) const -> std::string_view {
+		return words_->word(id);
+	}
+
+	auto ladder_set::ladder(std::size_t i) const -> std::vector<std::string> {
+		auto words = std::vector<std::string>{};
+		words.reserve(length_);
+		std::ranges::transform((*this)[i], std::back_inserter(words), [this](word_id id) {
+			return std::string(word(id));
+		});
+		return words;
+	}
+
+	auto ladder_set::to_strings() const -> std::vector<std::vector<std::string>> {
+		auto word_ladders = std::vector<std::vector<std::string>>{};
+		word_ladders.reserve(size());
+		for (auto i = std::size_t{0}; i < size(); ++i) {
+			word_ladders.push_back(ladder(i));
+		}
+		return word_ladders;
+	}
+
+	auto find_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_set {
+		auto result = ladder_set{};
+		if (from == to) {
+			result.words_ = graph.words_of_length(from.size());
+			if (result.words_ != nullptr) {
+				if (auto const id = result.words_->find(from)) {
+					result.ids_.push_back(*id);
+					result.length_ = 1;
+				}
+			}
+			return result;
+		}
+
+		// Copies the ids straight off the walk's stack, so no word is ever looked up
+		auto& ladders = thread_ladders();
+		ladders.reset(from, to, graph);
+		for (auto it = ladders.begin(); it != ladders.end(); ++it) {
+			result.length_ = ladders.path_.size();
+			std::ranges::transform(ladders.path_,
+			                       std::back_inserter(result.ids_),
+			                       &ladder_range::step::word);
+		}
+		if (!result.ids_.empty()) {
+			result.words_ = ladders.words_;
+		}
+		return result;
+	}
+
+	ladder_range::ladder_range(word_graph::partition const& words,
+	                           word_id source,
+	                           word_id target,
+	                           std::vector<std::uint32_t> positions)
+	: words_(&words)
+	, source_(source)
+	, target_(target)
+	, position_(std::move(positions))
+	, found_(true) {}
+
+	auto generate_batch(std::span<std::pair<std::string, std::string> const> queries,
+	                    lexicon const& words) -> std::vector<std::vector<std::vector<std::string>>> {
+		return generate_batch(queries, word_graph(words));
+	}
+
+	auto generate_batch(std::span<std::pair<std::string, std::string> const> queries,
+	                    word_graph const& graph) -> std::vector<std::vector<std::vector<std::string>>> {
+		auto results = std::vector<std::vector<std::vector<std::string>>>(queries.size());
+		// Every query is walked by the thread's one range, so each search starts from stamped
+		// distances and only clears the positions of the last query's ladders
+		auto& ladders = thread_ladders();
+		auto const collect = [&ladders](std::vector<std::vector<std::string>>& into) {
+			std::ranges::transform(ladders, std::back_inserter(into), [](auto const& ladder) {
+				return std::vector<std::string>(ladder.begin(), ladder.end());
+			});
+		};
+
+		// Queries are grouped by their source word. A query whose source appears nowhere else gets
+		// the usual bidirectional search; the rest share one search outward from their source.
+		auto by_source = std::unordered_map<std::string_view, std::vector<std::size_t>>{};
+		for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+			by_source[queries[i].first].push_back(i);
+		}
+
+		std::for_each(by_source.begin(), by_source.end(), [&](auto const& group) {
+			auto const& [from, indices] = group;
+			auto const* const words = graph.words_of_length(from.size());
+			auto const source = words == nullptr ? std::nullopt : words->find(from);
+			if (indices.size() == 1 or !source) {
+				for (auto const i : indices) {
+					ladders.reset(queries[i].first, queries[i].second, graph);
+					collect(results[i]);
+				}
+				return;
+			}
+
+			// Every target of the group that is a word of the same length, or nullopt
+			auto targets = std::vector<std::optional<word_id>>{};
+			auto reachable = std::vector<word_id>{};
+			for (auto const i : indices) {
+				auto const& to = queries[i].second;
+				auto target = to.size() == from.size() ? words->find(to) : std::nullopt;
+				if (target and !words->connected(*source, *target)) {
+					target = std::nullopt;
+				}
+				targets.push_back(target);
+				if (target) {
+					reachable.push_back(*target);
+				}
+			}
+
+			if (reachable.empty()) {
+				return;
+			}
+			auto const distances = search_from(*words, *source, reachable);
+			auto found = source_search{distances};
+			for (auto k = std::size_t{0}; k < indices.size(); ++k) {
+				auto const i = indices[k];
+				if (queries[i].first == queries[i].second) {
+					results[i] = {{queries[i].first}};
+					continue;
+				}
+				if (!targets[k] or found.from_source[*targets[k]] == unreached) {
+					continue;
+				}
+				found.length = found.from_source[*targets[k]];
+				ladders.words_ = words;
+				ladders.source_ = *source;
+				ladders.target_ = *targets[k];
+				ladders.found_ = true;
+				ladder_positions(*words, found, *targets[k], ladders.position_, ladders.on_ladder_);
+				collect(results[i]);
+			}
+		});
+		return results;
+	}
+
+	auto generate_parallel(std::string const& from,
+	                       std::string const& to,
+	                       word_graph const& graph,
+	                       std::size_t threads) -> std::vector<std::vector<std::string>> {
+		if (from == to) {
+			return {{from}};
+		}
+		auto const query = find_query(from, to, graph);
+		if (!query) {
+			return {};
+		}
+		auto const& [words, source, target] = *query;
+
+		auto buffers = search_buffers{};
+		auto const found =
+		   parallel_search(*words, source, target, buffers, std::max(threads, std::size_t{1}));
+		if (found.length == unreached) {
+			return {};
+		}
+		auto positions = std::vector<std::uint32_t>{};
+		auto on_ladder = std::vector<word_id>{};
+		ladder_positions(*words, found, target, positions, on_ladder);
+
+		auto ladders = ladder_range(*words, source, target, std::move(positions));
+		return copy_ladders(ladders);
+	}
+
+	auto count_ladders(std::string const& from, std::string const& to, word_graph const& graph)
+	   -> ladder_count {
+		if (from == to) {
+			return {1, 1};
+		}
+		auto& range = thread_ladders();
+		range.reset(from, to, graph);
+		if (!range.found_) {
+			return {};
+		}
+		auto const& words = *range.words_;
+		auto const& positions = range.position_;
+		auto const& on_ladder = range.on_ladder_;
+
+		// Only the counts of words on a ladder are ever read, so only those are cleared. The
+		// array grows to the largest length seen and is then kept.
+		thread_local auto ladders = std::vector<std::uint64_t>{};
+		if (ladders.size() < words.size()) {
+			ladders.resize(words.size());
+		}
+		std::for_each(on_ladder.begin(), on_ladder.end(), [](auto word) { ladders[word] = 0; });
+		ladders[range.source_] = 1;
+
+		// The DAG's words come nearest the target first, so going through them backwards visits
+		// each word only after every word that leads to it
+		std::for_each(on_ladder.rbegin(), on_ladder.rend(), [&](auto word) {
+			auto const position = positions[word] + 1;
+			for (auto const next : words.neighbors(word)) {
+				if (positions[next] != position) {
+					continue;
+				}
+				if (ladders[next] > std::numeric_limits<std::uint64_t>::max() - ladders[word]) {
+					throw std::overflow_error("Too many ladders to count.");
+				}
+				ladders[next] += ladders[word];
+			}
+		});
+		return {ladders[range.target_], std::size_t{positions[range.target_]} + 1};
+	}
+
+	auto rebuild_ladders(std::string const& from,
+	                     std::string const& to,
+	                     std::unordered_map<std::string, std::vector<std::string>> const& parents,
+	                     search_stats* stats) -> std::vector<std::vector<std::string>> {
+		return with_arena(nullptr, [&](std::pmr::memory_resource* arena) {
+			return with_recorder(stats, [&](auto const& record) {
+				return walk_ladders(from, to, parents, arena, record);
+			});
+		});
 	}
 
 	// Rebuild paths that intersected the ladder found
@@ -121,36 +1300,73 @@ namespace word_ladder {
 	                     std::vector<std::vector<std::string>>& intersections)
 	   -> std::vector<std::vector<std::string>> {
 		auto word_ladders = std::vector<std::vector<std::string>>{};
-		auto ladders_to_check = std::queue<std::vector<std::string>>{};
+		auto ladders_to_check = std::queue<std::size_t>{};
+
+		// Ladders are deduplicated by hashing rather than by searching every ladder found so far.
+		// The set holds indices into `word_ladders`, so each ladder is stored only once.
+		auto const hash_ladder = [&word_ladders](std::size_t i) {
+			auto seed = word_ladders[i].size();
+			for (auto const& word : word_ladders[i]) {
+				seed ^= std::hash<std::string>{}(word) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			}
+			return seed;
+		};
+		auto const same_ladder = [&word_ladders](std::size_t x, std::size_t y) {
+			return word_ladders[x] == word_ladders[y];
+		};
+		auto seen = std::unordered_set<std::size_t, decltype(hash_ladder), decltype(same_ladder)>(
+		   0, hash_ladder, same_ladder);
+		auto const add = [&](std::vector<std::string> new_result) {
+			word_ladders.push_back(std::move(new_result));
+			if (seen.insert(word_ladders.size() - 1).second) {
+				ladders_to_check.push(word_ladders.size() - 1);
+			}
+			else {
+				word_ladders.pop_back();
+			}
+		};
+
+		// Only intersections ending in a word of a ladder can be spliced into it, so look them up
+		// by their last word instead of trying every intersection against every ladder
+		auto intersections_ending_in =
+		   std::unordered_map<std::string_view, std::vector<std::size_t>>{};
+		for (auto i = std::size_t{0}; i < intersections.size(); ++i) {
+			if (!intersections[i].empty()) {
+				intersections_ending_in[intersections[i].back()].push_back(i);
+			}
+		}
 
-		word_ladders.push_back(ladder);
-		ladders_to_check.push(ladder);
+		add(ladder);
 
 		/* Check if there are any intersections between a word_ladder and prefixes in
 		intersecting_paths list. If there is, reconstruct word_ladder, adding it to queue to
 		also be checked*/
 		while (!ladders_to_check.empty()) {
-			auto next_result = ladders_to_check.front();
+			auto const next_result = ladders_to_check.front();
 			ladders_to_check.pop();
-			for (auto& intersection : intersections) {
-				auto found = std::find(next_result.begin(), next_result.end(), intersection.back());
-				if (found != next_result.end()) {
-					auto new_result = std::vector<std::string>{intersection};
-					new_result.insert(new_result.end(), ++found, next_result.end());
-
-					if (std::find(word_ladders.begin(), word_ladders.end(), new_result)
-					    == word_ladders.end()) {
-						word_ladders.push_back(new_result);
-						ladders_to_check.push(new_result);
-					}
+			for (auto found = std::size_t{0}; found < word_ladders[next_result].size(); ++found) {
+				auto const& word = word_ladders[next_result][found];
+				auto const matches = intersections_ending_in.find(word);
+				// A splice always happens at the first occurrence of a word
+				auto const first =
+				   word_ladders[next_result].begin() + static_cast<std::ptrdiff_t>(found);
+				if (matches == intersections_ending_in.end()
+				    or std::find(word_ladders[next_result].begin(), first, word) != first)
+				{
+					continue;
 				}
-			};
+				for (auto const i : matches->second) {
+					auto new_result = std::vector<std::string>{intersections[i]};
+					auto const& current = word_ladders[next_result];
+					new_result.insert(new_result.end(),
+					                  current.begin() + static_cast<std::ptrdiff_t>(found) + 1,
+					                  current.end());
+					add(std::move(new_result));
+				}
+			}
 		}
 
-		std::sort(word_ladders.begin(),
-		          word_ladders.end(),
-		          [](std::vector<std::string> x, std::vector<std::string> y) { return x < y; });
-
+		std::sort(word_ladders.begin(), word_ladders.end());
 		return word_ladders;
 	}
 
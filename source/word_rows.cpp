@@ -0,0 +1,204 @@
+// Copyright (c) Christopher Di Bella.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+#include <comp6771/word_rows.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <ranges>
+
+#if defined(__AVX2__) or defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace word_ladder {
+	namespace {
+		// Rows are padded to a multiple of one SSE register
+		constexpr auto row_alignment = std::size_t{16};
+
+		// Words whose rows are wider than this are compared a byte at a time
+		constexpr auto max_vector_stride = std::size_t{64};
+
+		// Returns whether `row` and `word`, both `length` bytes, differ in exactly one byte
+		auto one_apart(char const* row, char const* word, std::size_t length) -> bool {
+			auto differences = 0;
+			for (auto i = std::size_t{0}; i < length and differences < 2; ++i) {
+				differences += row[i] != word[i];
+			}
+			return differences == 1;
+		}
+
+		// Given a mask with a bit set for each byte that differs, returns 0, 1, or 2 for two or more.
+		// This avoids std::popcount, which is a library call on targets without POPCNT.
+		auto differences(unsigned differ) -> int {
+			if (differ == 0) {
+				return 0;
+			}
+			return (differ & (differ - 1)) == 0 ? 1 : 2;
+		}
+
+#if defined(__SSE2__)
+		// Which of the 16 bytes at `row` and `word` differ, one bit per byte
+		auto differ_mask(char const* row, char const* word) -> unsigned {
+			auto const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row));
+			auto const b = _mm_load_si128(reinterpret_cast<__m128i const*>(word));
+			return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) & 0xFFFFU;
+		}
+#endif
+
+#if defined(__AVX2__)
+		// Which of the 32 bytes at `row` and `word` differ, one bit per byte
+		auto wide_differ_mask(char const* row, char const* word) -> unsigned {
+			auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(row));
+			auto const b = _mm256_load_si256(reinterpret_cast<__m256i const*>(word));
+			return ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+		}
+#endif
+	} // namespace
+
+	word_rows::word_rows(std::unordered_set<std::string> const& lexicon) {
+		auto by_length = std::vector<std::vector<std::string_view>>{};
+		std::for_each(lexicon.begin(), lexicon.end(), [&by_length](auto const& s) {
+			if (by_length.size() <= s.size()) {
+				by_length.resize(s.size() + 1);
+			}
+			by_length[s.size()].push_back(s);
+		});
+		build(by_length);
+	}
+
+	word_rows::word_rows(lexicon const& words) {
+		auto by_length = std::vector<std::vector<std::string_view>>(words.max_length() + 1);
+		for (auto length = std::size_t{1}; length < by_length.size(); ++length) {
+			auto const& bucket = words.words_of_length(length);
+			by_length[length].assign(bucket.begin(), bucket.end());
+		}
+		build(by_length);
+	}
+
+	auto word_rows::build(std::vector<std::vector<std::string_view>>& by_length) -> void {
+		partitions_.resize(by_length.size());
+		for (auto length = std::size_t{1}; length < by_length.size(); ++length) {
+			auto& sorted = by_length[length];
+			std::sort(sorted.begin(), sorted.end());
+
+			auto& part = partitions_[length];
+			part.length = length;
+			part.stride = (length + row_alignment - 1) / row_alignment * row_alignment;
+			part.rows.assign(sorted.size() * part.stride, '\0');
+			for (auto row = std::size_t{0}; row < sorted.size(); ++row) {
+				std::memcpy(part.rows.data() + row * part.stride, sorted[row].data(), length);
+			}
+		}
+	}
+
+	auto word_rows::contains(std::string_view word) const -> bool {
+		return find(word).has_value();
+	}
+
+	auto word_rows::word_count(std::size_t length) const -> std::size_t {
+		auto const* const part = find_partition(length);
+		return part == nullptr ? 0 : part->size();
+	}
+
+	auto word_rows::find(std::string_view word) const -> std::optional<std::uint32_t> {
+		auto const* const part = find_partition(word.size());
+		if (part == nullptr) {
+			return std::nullopt;
+		}
+		auto const rows =
+		   std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(part->size()));
+		auto const found = std::ranges::lower_bound(rows, word, {}, [part](auto row) {
+			return part->word(row);
+		});
+		if (found == rows.end() or part->word(*found) != word) {
+			return std::nullopt;
+		}
+		return *found;
+	}
+
+	auto word_rows::find_partition(std::size_t length) const -> partition const* {
+		if (length >= partitions_.size() or partitions_[length].rows.empty()) {
+			return nullptr;
+		}
+		return &partitions_[length];
+	}
+
+	auto word_rows::partition::size() const -> std::size_t {
+		return stride == 0 ? 0 : rows.size() / stride;
+	}
+
+	auto word_rows::partition::word(std::size_t row) const -> std::string_view {
+		return std::string_view(rows.data() + row * stride, length);
+	}
+
+	auto word_rows::partition::scan(std::string_view word,
+	                                std::size_t first,
+	                                std::uint32_t* hits) const -> std::size_t {
+		auto const last = std::min(first + rows_per_scan, size());
+		auto found = std::size_t{0};
+		auto const keep = [&found, hits](std::size_t row) {
+			hits[found++] = static_cast<std::uint32_t>(row);
+		};
+
+#if defined(__SSE2__)
+		if (stride <= max_vector_stride) {
+			// The word, padded the same way as the rows
+			alignas(32) auto padded = std::array<char, max_vector_stride>{};
+			std::memcpy(padded.data(), word.data(), word.size());
+			auto row = first;
+#if defined(__AVX2__)
+			if (stride == row_alignment) {
+				// Two rows to a register: the low 16 bits of the mask are one row, the high 16 the next
+				std::memcpy(padded.data() + row_alignment, padded.data(), row_alignment);
+				auto const pair = _mm256_load_si256(reinterpret_cast<__m256i const*>(padded.data()));
+				for (; row + 2 <= last; row += 2) {
+					auto const rows_at = _mm256_loadu_si256(
+					   reinterpret_cast<__m256i const*>(rows.data() + row * stride));
+					auto const differ =
+					   ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(rows_at, pair)));
+					if (differences(differ & 0xFFFFU) == 1) {
+						keep(row);
+					}
+					if (differences(differ >> 16U) == 1) {
+						keep(row + 1);
+					}
+				}
+			}
+#endif
+			if (stride == row_alignment) {
+				for (; row < last; ++row) {
+					if (differences(differ_mask(rows.data() + row * stride, padded.data())) == 1) {
+						keep(row);
+					}
+				}
+				return found;
+			}
+			for (; row < last; ++row) {
+				auto const* const at = rows.data() + row * stride;
+				auto count = 0;
+				auto offset = std::size_t{0};
+#if defined(__AVX2__)
+				for (; offset + 32 <= stride and count < 2; offset += 32) {
+					count += differences(wide_differ_mask(at + offset, padded.data() + offset));
+				}
+#endif
+				for (; offset < stride and count < 2; offset += row_alignment) {
+					count += differences(differ_mask(at + offset, padded.data() + offset));
+				}
+				if (count == 1) {
+					keep(row);
+				}
+			}
+			return found;
+		}
+#endif
+
+		for (auto row = first; row < last; ++row) {
+			if (one_apart(rows.data() + row * stride, word.data(), length)) {
+				keep(row);
+			}
+		}
+		return found;
+	}
+} // namespace word_ladder
@@ -0,0 +1,80 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+generate() puts all of its per-query scratch in an arena. A caller's own arena must give the same
+answers as the arena generate() makes for itself, must actually be used, and must be reusable
+after release().
+*/
+
+namespace {
+	// Counts the bytes it hands out, and forwards to its upstream resource
+	class counting_resource : public std::pmr::memory_resource {
+	public:
+		std::size_t bytes = 0;
+
+	private:
+		auto do_allocate(std::size_t size, std::size_t alignment) -> void* override {
+			bytes += size;
+			return std::pmr::new_delete_resource()->allocate(size, alignment);
+		}
+
+		auto do_deallocate(void* p, std::size_t size, std::size_t alignment) -> void override {
+			std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+		}
+
+		[[nodiscard]] auto do_is_equal(memory_resource const& other) const noexcept -> bool override {
+			return this == &other;
+		}
+	};
+} // namespace
+
+TEST_CASE("Caller-Supplied Arena") {
+	auto const english_set = word_ladder::read_lexicon("english.txt");
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const english_index = word_ladder::neighbor_index(english_lexicon);
+	auto upstream = counting_resource{};
+	auto arena = std::pmr::monotonic_buffer_resource(&upstream);
+
+	SECTION("Same Answers With And Without An Arena") {
+		auto const expected = word_ladder::generate("awake", "sleep", english_lexicon);
+		CHECK(expected.size() == 2);
+		CHECK(word_ladder::generate("awake", "sleep", english_set, &arena) == expected);
+		CHECK(word_ladder::generate("awake", "sleep", english_lexicon, &arena) == expected);
+		CHECK(word_ladder::generate("awake", "sleep", english_index, &arena) == expected);
+		CHECK(upstream.bytes > 0);
+	}
+
+	SECTION("Reused After release()") {
+		auto const expected = word_ladder::generate("atlases", "cabaret", english_index);
+		CHECK(expected.size() == 840);
+		for (auto round = 0; round < 3; ++round) {
+			CHECK(word_ladder::generate("atlases", "cabaret", english_index, &arena) == expected);
+			arena.release();
+		}
+		CHECK(word_ladder::generate("airplane", "tricycle", english_lexicon, &arena).empty());
+	}
+}
@@ -0,0 +1,73 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/batch_solver.hpp>
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+The batch solver spreads queries over several threads and lets idle threads steal from busy
+ones. Whatever the number of threads and whoever ends up solving each query, every answer must be
+what generate() gives, in the slot of the query it answers.
+*/
+
+TEST_CASE("Multi-Threaded Batches") {
+	auto const graph = word_ladder::word_graph(word_ladder::load_lexicon("english.txt"));
+
+	// A few slow queries among many quick ones, so that threads run out of work unevenly
+	auto queries = std::vector<std::pair<std::string, std::string>>{
+	   {"atlases", "cabaret"},
+	   {"airplane", "tricycle"},
+	   {"work", "play"},
+	   {"awake", "sleep"},
+	   {"cat", "cat"},
+	   {"cat", "dogs"},
+	   {"zzz", "cat"},
+	};
+	auto const words = std::vector<std::string>{"cold", "warm", "wood", "bard", "tide", "mice"};
+	for (auto const& from : words) {
+		for (auto const& to : words) {
+			queries.emplace_back(from, to);
+		}
+	}
+
+	auto expected = std::vector<std::vector<std::vector<std::string>>>{};
+	for (auto const& [from, to] : queries) {
+		expected.push_back(word_ladder::generate(from, to, graph));
+	}
+
+	SECTION("Answers Are The Same For Any Number Of Threads") {
+		for (auto const threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}}) {
+			auto solver = word_ladder::batch_solver(graph, threads);
+			CHECK(solver.thread_count() == threads);
+			CHECK(solver.solve(queries) == expected);
+		}
+	}
+
+	SECTION("A Solver Can Be Reused") {
+		auto solver = word_ladder::batch_solver(graph, 3);
+		CHECK(solver.solve(queries) == expected);
+		CHECK(solver.solve({}).empty());
+		CHECK(solver.solve(queries) == expected);
+	}
+}
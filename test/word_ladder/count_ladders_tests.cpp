@@ -0,0 +1,92 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+count_ladders() must agree with the number and length of the ladders generate() returns, and it
+must keep going well past the point where the ladders could ever be built. Every word of a
+hypercube of a/b strings has a shortest ladder to its complement for each order of the positions,
+so n positions give n! ladders from only 2^n words.
+*/
+
+TEST_CASE("Counting Ladders") {
+	SECTION("Counts Match generate()") {
+		auto const queries = std::vector<std::pair<std::string, std::pair<std::string, std::string>>>{
+		   {"OnePathSuccess.txt", {"aaa", "zzz"}},
+		   {"MultipleHopsFailure.txt", {"aaa", "zzz"}},
+		   {"BasicMultiplePathsSuccess.txt", {"aaa", "acb"}},
+		   {"MultiplesPathsWithDoubleUps.txt", {"aaaaaa", "zzaaaz"}},
+		   {"BasicEmbeddedDubUps.txt", {"aaaaaa", "zaaazz"}},
+		   {"ComplexCollidingPaths.txt", {"GOAL", "QUIZ"}},
+		   {"english.txt", {"atlases", "cabaret"}},
+		   {"english.txt", {"awake", "sleep"}},
+		   {"english.txt", {"airplane", "tricycle"}},
+		};
+		for (auto const& [file, query] : queries) {
+			auto const lexicon = word_ladder::read_lexicon(file);
+			auto const graph = word_ladder::word_graph(lexicon);
+			auto const ladders = word_ladder::generate(query.first, query.second, graph);
+			auto const count = word_ladder::count_ladders(query.first, query.second, graph);
+			CHECK(count.ladders == ladders.size());
+			CHECK(count.length == (ladders.empty() ? 0 : ladders.front().size()));
+		}
+	}
+
+	SECTION("Trivial Queries") {
+		auto const graph = word_ladder::word_graph(word_ladder::read_lexicon("OnePathSuccess.txt"));
+		auto const same = word_ladder::count_ladders("aaa", "aaa", graph);
+		CHECK(same.ladders == 1);
+		CHECK(same.length == 1);
+
+		auto const missing = word_ladder::count_ladders("aaa", "qqq", graph);
+		CHECK(missing.ladders == 0);
+		CHECK(missing.length == 0);
+	}
+
+	SECTION("Counts Too Many Ladders To Build") {
+		auto constexpr positions = 16;
+		auto lexicon = std::unordered_set<std::string>{};
+		for (auto bits = 0U; bits < (1U << positions); ++bits) {
+			auto word = std::string(positions, 'a');
+			for (auto i = 0; i < positions; ++i) {
+				if ((bits >> i) & 1U) {
+					word[static_cast<std::size_t>(i)] = 'b';
+				}
+			}
+			lexicon.insert(word);
+		}
+		auto const graph = word_ladder::word_graph(lexicon);
+
+		auto factorial = std::uint64_t{1};
+		for (auto i = std::uint64_t{2}; i <= positions; ++i) {
+			factorial *= i;
+		}
+		auto const count = word_ladder::count_ladders(std::string(positions, 'a'),
+		                                              std::string(positions, 'b'),
+		                                              graph);
+		CHECK(count.ladders == factorial);
+		CHECK(count.length == positions + 1);
+	}
+}
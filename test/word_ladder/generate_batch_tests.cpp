@@ -0,0 +1,76 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+generate_batch() shares one word graph, and one search per repeated source word, across a whole
+batch. Each query's answer must still be exactly what generate() gives for it alone, in the order
+the queries were given, whether or not its source is shared. Like generate() over a word graph, it
+finds nothing from a source that is not a word.
+*/
+
+TEST_CASE("Batch Queries") {
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"work", "play"},
+	   {"awake", "sleep"},
+	   {"work", "cold"},
+	   {"atlases", "cabaret"},
+	   {"work", "work"},
+	   {"sleep", "awake"},
+	   {"work", "warm"},
+	   {"work", "plays"},
+	   {"work", "zzzz"},
+	   {"airplane", "tricycle"},
+	   {"awake", "sleep"},
+	   {"cat", "dog"},
+	   {"zzz", "cat"},
+	   {"zzz", "dog"},
+	};
+
+	SECTION("Every Answer Matches generate(), In Input Order") {
+		auto const results = word_ladder::generate_batch(queries, english_lexicon);
+		REQUIRE(results.size() == queries.size());
+		for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+			CHECK(results[i]
+			      == word_ladder::generate(queries[i].first, queries[i].second, english_lexicon));
+		}
+	}
+
+	SECTION("A Source That Is Not A Word Has No Ladders") {
+		// As generate() over a word_graph, not as generate() over the lexicon, which probes from
+		// any source
+		auto const graph = word_ladder::word_graph(english_lexicon);
+		auto const odd = std::vector<std::pair<std::string, std::string>>{{"xat", "cot"}};
+		auto const results = word_ladder::generate_batch(odd, english_lexicon);
+		REQUIRE(results.size() == 1);
+		CHECK(results[0].empty());
+		CHECK(results[0] == word_ladder::generate("xat", "cot", graph));
+		CHECK(!word_ladder::generate("xat", "cot", english_lexicon).empty());
+	}
+
+	SECTION("An Empty Batch Has No Answers") {
+		CHECK(word_ladder::generate_batch({}, english_lexicon).empty());
+	}
+}
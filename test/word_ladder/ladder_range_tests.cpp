@@ -0,0 +1,113 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+ladder_range hands out ladders one at a time instead of building them all up front. These tests
+check that it yields the same ladders as generate(), in the same order; that a caller can stop
+early; and that the edge cases (a one-word ladder, no ladder at all) behave like generate().
+*/
+
+namespace {
+	auto collect(word_ladder::ladder_range& ladders) -> std::vector<std::vector<std::string>> {
+		auto result = std::vector<std::vector<std::string>>{};
+		for (auto const& ladder : ladders) {
+			result.emplace_back(ladder.begin(), ladder.end());
+		}
+		return result;
+	}
+} // namespace
+
+static_assert(std::ranges::input_range<word_ladder::ladder_range>);
+
+TEST_CASE("Lazy Ladder Enumeration") {
+	auto const english_lexicon = word_ladder::read_lexicon("english.txt");
+	auto const graph = word_ladder::word_graph(english_lexicon);
+
+	SECTION("Yields What generate() Returns, In Order") {
+		auto const queries = std::vector<std::pair<std::string, std::string>>{
+		   {"atlases", "cabaret"},
+		   {"awake", "sleep"},
+		   {"work", "play"},
+		   {"cat", "cat"},
+		   {"cat", "dogs"},
+		   {"cat", "zzz"},
+		};
+		for (auto const& [from, to] : queries) {
+			auto ladders = word_ladder::enumerate_ladders(from, to, graph);
+			CHECK(collect(ladders) == word_ladder::generate(from, to, graph));
+		}
+	}
+
+	SECTION("Stopping Early Gives The First Ladders") {
+		auto const all = word_ladder::generate("atlases", "cabaret", graph);
+		auto ladders = word_ladder::enumerate_ladders("atlases", "cabaret", graph);
+
+		auto first = std::vector<std::vector<std::string>>{};
+		for (auto const& ladder : ladders | std::views::take(3)) {
+			first.emplace_back(ladder.begin(), ladder.end());
+		}
+		REQUIRE(std::size(first) == 3);
+		CHECK(first == std::vector<std::vector<std::string>>(all.begin(), all.begin() + 3));
+	}
+
+	SECTION("A Range Can Be Walked Again") {
+		auto ladders = word_ladder::enumerate_ladders("awake", "sleep", graph);
+		auto const once = collect(ladders);
+		CHECK(std::size(once) == 2);
+		CHECK(collect(ladders) == once);
+
+		auto same = word_ladder::enumerate_ladders("cat", "cat", graph);
+		CHECK(collect(same) == std::vector<std::vector<std::string>>{{"cat"}});
+		CHECK(collect(same) == std::vector<std::vector<std::string>>{{"cat"}});
+	}
+
+	SECTION("Reset Forgets The Last Query") {
+		// Each search only stamps its distances, so nothing from an earlier query, of the same
+		// length or not, may leak into a later one
+		auto ladders = word_ladder::ladder_range{};
+		auto const queries = std::vector<std::pair<std::string, std::string>>{
+		   {"awake", "sleep"},
+		   {"sleep", "awake"},
+		   {"atlases", "cabaret"},
+		   {"awake", "sleep"},
+		   {"work", "play"},
+		   {"airplane", "tricycle"},
+		   {"cat", "cat"},
+		   {"play", "work"},
+		   {"work", "play"},
+		};
+		for (auto const& [from, to] : queries) {
+			ladders.reset(from, to, graph);
+			CHECK(collect(ladders) == word_ladder::generate(from, to, graph));
+		}
+	}
+
+	SECTION("No Ladders Means An Empty Range") {
+		auto ladders = word_ladder::enumerate_ladders("airplane", "tricycle", graph);
+		CHECK(ladders.begin() == ladders.end());
+	}
+}
@@ -0,0 +1,75 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+find_ladders() returns its ladders as word ids. Converted back to strings they must match
+generate(), and comparing ids must order ladders the same way comparing their words does.
+*/
+
+TEST_CASE("Ladders As Word Ids") {
+	auto const english_lexicon = word_ladder::read_lexicon("english.txt");
+	auto const graph = word_ladder::word_graph(english_lexicon);
+
+	SECTION("Converts Back To What generate() Returns") {
+		auto const queries = std::vector<std::pair<std::string, std::string>>{
+		   {"atlases", "cabaret"},
+		   {"awake", "sleep"},
+		   {"work", "play"},
+		   {"cat", "cat"},
+		   {"cat", "dogs"},
+		   {"airplane", "tricycle"},
+		};
+		for (auto const& [from, to] : queries) {
+			CHECK(word_ladder::find_ladders(from, to, graph).to_strings()
+			      == word_ladder::generate(from, to, graph));
+		}
+	}
+
+	SECTION("Shape Of The Result") {
+		auto const ladders = word_ladder::find_ladders("atlases", "cabaret", graph);
+		REQUIRE(ladders.size() == 840);
+		CHECK(ladders.ladder_length() == 58);
+		CHECK(ladders[0].size() == 58);
+		CHECK(ladders.word(ladders[0].front()) == "atlases");
+		CHECK(ladders.word(ladders[839].back()) == "cabaret");
+		CHECK(ladders.ladder(0) == word_ladder::generate("atlases", "cabaret", graph).front());
+	}
+
+	SECTION("Ids Sort Like Words") {
+		auto const ladders = word_ladder::find_ladders("atlases", "cabaret", graph);
+		for (auto i = std::size_t{1}; i < ladders.size(); ++i) {
+			CHECK(std::ranges::lexicographical_compare(ladders[i - 1], ladders[i]));
+			CHECK(ladders.ladder(i - 1) < ladders.ladder(i));
+		}
+	}
+
+	SECTION("No Ladders") {
+		CHECK(word_ladder::find_ladders("airplane", "tricycle", graph).empty());
+		CHECK(word_ladder::find_ladders("cat", "zzz", graph).empty());
+		CHECK(word_ladder::find_ladders("zzz", "zzz", graph).empty());
+		CHECK(word_ladder::find_ladders("cat", "cat", graph).size() == 1);
+		CHECK(word_ladder::find_ladders("cat", "dogs", graph) == word_ladder::ladder_set{});
+	}
+}
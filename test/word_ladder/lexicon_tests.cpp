@@ -0,0 +1,172 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+The length-partitioned lexicon is loaded once and then handed to generate() so each query can use
+the words of its own length directly. These tests check the partitioning itself, and that queries
+against it agree with queries against the plain set from read_lexicon(). A lexicon is shared
+between threads as it is, so the last test has many threads copy and query one lexicon at once; it
+is meant to be run under ThreadSanitizer as well.
+*/
+
+TEST_CASE("Length-Partitioned Lexicon") {
+	SECTION("Empty") {
+		auto const lexicon = word_ladder::load_lexicon("Empty.txt");
+
+		CHECK(lexicon.size() == 0);
+		CHECK(lexicon.words_of_length(1).empty());
+		CHECK(word_ladder::generate("a", "z", lexicon).empty());
+	}
+
+	SECTION("Words Are Filed By Length") {
+		auto const lexicon = word_ladder::load_lexicon("ComplexCollidingPaths.txt");
+
+		CHECK(lexicon.size() == word_ladder::read_lexicon("ComplexCollidingPaths.txt").size());
+		CHECK(lexicon.words_of_length(3).size() == 1);
+		CHECK(lexicon.words_of_length(3).contains("ZZZ"));
+		CHECK(lexicon.words_of_length(4).contains("GOAL"));
+		CHECK(lexicon.words_of_length(5).empty());
+		CHECK(lexicon.letters_of_length(3) == "Z");
+		CHECK(lexicon.contains("QUIZ"));
+		CHECK(!lexicon.contains("QUIT "));
+	}
+
+	SECTION("Built From A Set") {
+		auto const words = word_ladder::read_lexicon("NoLoops.txt");
+		auto const lexicon = word_ladder::lexicon(words);
+
+		CHECK(lexicon.size() == words.size());
+		CHECK(lexicon.max_length() == 5);
+		CHECK(lexicon.letters_of_length(5) == "abg");
+	}
+
+	SECTION("Copies Share Their Words") {
+		auto copy = word_ladder::lexicon{};
+		{
+			auto const lexicon = word_ladder::load_lexicon("OnePathSuccess.txt");
+			copy = lexicon;
+		}
+		CHECK(copy.contains("azz"));
+		CHECK(word_ladder::generate("aaa", "zzz", copy)
+		      == std::vector<std::vector<std::string>>{{"aaa", "aaz", "azz", "zzz"}});
+	}
+
+	SECTION("Copies Do Not Duplicate Their Words") {
+		auto const lexicon = word_ladder::load_lexicon("OnePathSuccess.txt");
+		auto const copy = lexicon;
+		CHECK(&copy.words_of_length(3) == &lexicon.words_of_length(3));
+	}
+}
+
+TEST_CASE("Memory-Mapped Lexicon") {
+	SECTION("Empty File") {
+		auto const lexicon = word_ladder::map_lexicon("Empty.txt");
+
+		CHECK(lexicon.size() == 0);
+		CHECK(word_ladder::generate("a", "z", lexicon).empty());
+	}
+
+	SECTION("Missing File") {
+		CHECK_THROWS_AS(word_ladder::map_lexicon("NoSuchFile.txt"), std::runtime_error);
+	}
+
+	SECTION("Mapping Outlives The Lexicon It Was Loaded Into") {
+		auto copy = word_ladder::lexicon{};
+		{
+			auto const lexicon = word_ladder::map_lexicon("BasicMultiplePathsSuccess.txt");
+			copy = lexicon;
+		}
+		CHECK(copy.size() == 7);
+		CHECK(word_ladder::generate("aaa", "acb", copy)
+		      == std::vector<std::vector<std::string>>{{"aaa", "aab", "acb"}, {"aaa", "aca", "acb"}});
+	}
+}
+
+TEST_CASE("Partitioned Search Matches Set Search") {
+	auto const english_set = word_ladder::read_lexicon("english.txt");
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const mapped_lexicon = word_ladder::map_lexicon("english.txt");
+
+	CHECK(english_lexicon.size() == english_set.size());
+	CHECK(mapped_lexicon.size() == english_set.size());
+
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"awake", "sleep"},
+	   {"work", "play"},
+	   {"atlases", "cabaret"},
+	   {"airplane", "tricycle"},
+	   {"cat", "cat"},
+	   {"cat", "dogs"},
+	};
+	for (auto const& [from, to] : queries) {
+		auto const ladders = word_ladder::generate(from, to, english_set);
+		CHECK(word_ladder::generate(from, to, english_lexicon) == ladders);
+		CHECK(word_ladder::generate(from, to, mapped_lexicon) == ladders);
+	}
+}
+
+TEST_CASE("Concurrent Queries Share One Lexicon") {
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"awake", "sleep"},
+	   {"work", "play"},
+	   {"cold", "warm"},
+	   {"cat", "dogs"},
+	};
+	auto expected = std::vector<std::vector<std::vector<std::string>>>{};
+	for (auto const& [from, to] : queries) {
+		expected.push_back(word_ladder::generate(from, to, english_lexicon));
+	}
+
+	// Half the threads query the shared lexicon directly, half through copies of the handle they
+	// make and drop as they go
+	auto constexpr threads = std::size_t{8};
+	auto constexpr rounds = 4;
+	auto mismatches = std::vector<int>(threads);
+	{
+		auto workers = std::vector<std::jthread>{};
+		for (auto thread = std::size_t{0}; thread < threads; ++thread) {
+			workers.emplace_back([&, thread] {
+				for (auto round = 0; round < rounds; ++round) {
+					for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+						auto const query = (i + thread) % queries.size();
+						auto const& [from, to] = queries[query];
+						auto const copy = english_lexicon;
+						auto const& lexicon = thread % 2 == 0 ? english_lexicon : copy;
+						if (word_ladder::generate(from, to, lexicon) != expected[query]
+						    or !lexicon.contains(from))
+						{
+							++mismatches[thread];
+						}
+					}
+				}
+			});
+		}
+	}
+	CHECK(mismatches == std::vector<int>(threads));
+}
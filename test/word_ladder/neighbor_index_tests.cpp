@@ -0,0 +1,120 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+The wildcard-bucket index is meant to be a drop-in replacement for probing the lexicon with every
+one-letter mutation of a word, so these tests check the buckets directly and then check that
+generate() gives identical answers whichever way it finds neighbours.
+*/
+
+TEST_CASE("Wildcard Buckets") {
+	auto const lexicon = word_ladder::read_lexicon("OnePathSuccess.txt");
+	auto const index = word_ladder::neighbor_index(lexicon);
+
+	SECTION("Bucket Holds Every Word Matching The Pattern") {
+		CHECK(index.bucket("*aa") == std::vector<std::string_view>{"aaa", "baa", "caa"});
+		CHECK(index.bucket("aa*") == std::vector<std::string_view>{"aaa", "aas", "aaz"});
+		CHECK(index.bucket("a*z") == std::vector<std::string_view>{"aaz", "azz"});
+		CHECK(index.bucket("q*q").empty());
+		CHECK(index.bucket("*aaa").empty());
+	}
+
+	SECTION("Neighbours Exclude The Word Itself") {
+		auto neighbours = std::vector<std::string_view>{};
+		index.for_each_neighbor("aaa", [&](auto word) { neighbours.push_back(word); });
+		std::sort(neighbours.begin(), neighbours.end());
+
+		CHECK(neighbours == std::vector<std::string_view>{"aas", "aaz", "baa", "caa"});
+	}
+
+	SECTION("Neighbours Of A Word Outside The Lexicon") {
+		auto neighbours = std::vector<std::string_view>{};
+		index.for_each_neighbor("zza", [&](auto word) { neighbours.push_back(word); });
+
+		CHECK(neighbours == std::vector<std::string_view>{"zzz"});
+		CHECK(!index.contains("zza"));
+		CHECK(index.contains("zzz"));
+	}
+
+	SECTION("Words Are Numbered In Sorted Order") {
+		CHECK(index.word_count(3) == 11);
+		CHECK(index.word_count(4) == 0);
+		CHECK(index.find("aaa") == 0U);
+		CHECK(index.find("baa") == 4U);
+		CHECK(index.find("zzz") == 10U);
+		CHECK(!index.find("zza"));
+
+		auto ids = std::vector<std::uint32_t>{};
+		index.for_each_neighbor_id("aaa", [&](auto id, auto word) {
+			CHECK(index.find(word) == id);
+			ids.push_back(id);
+		});
+		std::sort(ids.begin(), ids.end());
+		CHECK(ids == std::vector<std::uint32_t>{1, 2, 4, 7});
+	}
+
+	SECTION("Components Are Labelled By Their Smallest Id") {
+		// aaa, aas, aaz, azz, baa, bba, bbb, caa and zzz are joined by steps; fek and sdf are alone
+		CHECK(index.component(3, *index.find("zzz")) == 0U);
+		CHECK(index.component(3, *index.find("bbb")) == 0U);
+		CHECK(index.component(3, *index.find("fek")) == *index.find("fek"));
+		CHECK(index.connected(3, *index.find("aaa"), *index.find("bbb")));
+		CHECK(!index.connected(3, *index.find("fek"), *index.find("sdf")));
+
+		// A query across components is answered without a search
+		auto stats = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("fek", "aaa", index, nullptr, &stats).empty());
+		CHECK(stats.layers == 0);
+		CHECK(!word_ladder::generate("aaa", "zzz", index).empty());
+	}
+
+	SECTION("Patterns Need Exactly One Wildcard") {
+		CHECK_THROWS_AS(index.bucket("aaa"), std::invalid_argument);
+		CHECK_THROWS_AS(index.bucket("**a"), std::invalid_argument);
+	}
+}
+
+TEST_CASE("Index Search Matches Hash Probing") {
+	auto const english_lexicon = word_ladder::read_lexicon("english.txt");
+	auto const index = word_ladder::neighbor_index(english_lexicon);
+
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"awake", "sleep"},
+	   {"work", "play"},
+	   {"atlases", "cabaret"},
+	   {"airplane", "tricycle"},
+	   {"cat", "cat"},
+	};
+	for (auto const& [from, to] : queries) {
+		CHECK(word_ladder::generate(from, to, index)
+		      == word_ladder::generate(from, to, english_lexicon));
+	}
+
+	auto const colliding = word_ladder::read_lexicon("ComplexCollidingPaths.txt");
+	CHECK(word_ladder::generate("GOAL", "QUIZ", word_ladder::neighbor_index(colliding)).size() == 8);
+}
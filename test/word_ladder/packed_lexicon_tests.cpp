@@ -0,0 +1,118 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/packed_lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+A packed_lexicon holds words of up to twelve letters as 64-bit keys. Packing must round-trip and
+refuse anything it cannot hold; the keys' neighbours must be exactly the index's; and generate()
+over it must match the other engines, falling back to them for lengths it does not pack.
+*/
+
+namespace {
+	auto neighbors_of(word_ladder::packed_lexicon const& words, std::string_view word)
+	   -> std::vector<std::string> {
+		auto result = std::vector<std::string>{};
+		words.for_each_neighbor(*word_ladder::packed_lexicon::pack(word),
+		                        word.size(),
+		                        [&result](word_ladder::packed_lexicon::key next) {
+			                        result.push_back(word_ladder::packed_lexicon::unpack(next));
+		                        });
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	auto neighbors_of(word_ladder::neighbor_index const& index, std::string_view word)
+	   -> std::vector<std::string> {
+		auto result = std::vector<std::string>{};
+		index.for_each_neighbor(word, [&result](std::string_view next) { result.emplace_back(next); });
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+} // namespace
+
+TEST_CASE("Packed Lexicon") {
+	using word_ladder::packed_lexicon;
+
+	SECTION("Packing") {
+		CHECK(packed_lexicon::pack("a") == 1U);
+		CHECK(packed_lexicon::pack("ba") == 2U + (1U << 5U));
+		CHECK(packed_lexicon::unpack(*packed_lexicon::pack("zebra")) == "zebra");
+		CHECK(packed_lexicon::unpack(*packed_lexicon::pack("abcdefghijkl")) == "abcdefghijkl");
+		CHECK(packed_lexicon::pack("") == std::nullopt);
+		CHECK(packed_lexicon::pack("abcdefghijklm") == std::nullopt);
+		CHECK(packed_lexicon::pack("Cat") == std::nullopt);
+		CHECK(packed_lexicon::pack("it's") == std::nullopt);
+	}
+
+	SECTION("Same Neighbours As The Index") {
+		auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+		auto const index = word_ladder::neighbor_index(english_lexicon);
+		auto const words = packed_lexicon(english_lexicon);
+		for (auto length = std::size_t{2}; length <= packed_lexicon::max_length; ++length) {
+			REQUIRE(words.packed(length));
+			auto n = std::size_t{0};
+			for (auto const word : english_lexicon.words_of_length(length)) {
+				if (n++ % 97 == 0) {
+					CHECK(words.contains(*packed_lexicon::pack(word), length));
+					CHECK(neighbors_of(words, word) == neighbors_of(index, word));
+				}
+			}
+		}
+		CHECK(!words.packed(1));
+		CHECK(!words.packed(packed_lexicon::max_length + 1));
+		CHECK(!words.contains(*packed_lexicon::pack("zzzzz"), 5));
+		CHECK(neighbors_of(words, "zzzzz") == neighbors_of(index, "zzzzz"));
+	}
+
+	SECTION("Ladders Match The Other Engines") {
+		auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+		auto const words = packed_lexicon(english_lexicon);
+		CHECK(word_ladder::generate("awake", "sleep", words)
+		      == word_ladder::generate("awake", "sleep", english_lexicon));
+		CHECK(word_ladder::generate("work", "play", words)
+		      == word_ladder::generate("work", "play", english_lexicon));
+		CHECK(word_ladder::generate("atlases", "cabaret", words).size() == 840);
+		CHECK(word_ladder::generate("airplane", "tricycle", words).empty());
+		CHECK(word_ladder::generate("cat", "cat", words)
+		      == std::vector<std::vector<std::string>>{{"cat"}});
+		CHECK(word_ladder::generate("cat", "zzz", words).empty());
+		CHECK(word_ladder::generate("cat", "dogs", words).empty());
+	}
+
+	SECTION("Unpacked Lengths Fall Back") {
+		auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "ca-t", "co-t"};
+		auto const words = packed_lexicon(lexicon);
+		CHECK(words.packed(3));
+		CHECK(!words.packed(4));
+		CHECK(word_ladder::generate("cat", "dog", words)
+		      == std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}});
+		CHECK(word_ladder::generate("ca-t", "co-t", words)
+		      == std::vector<std::vector<std::string>>{{"ca-t", "co-t"}});
+	}
+}
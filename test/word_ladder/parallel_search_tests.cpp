@@ -0,0 +1,81 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+generate_parallel() splits each large layer of the search between threads. The English lexicon
+rarely has layers big enough to be split, so a dense synthetic lexicon is used as well: a random
+third of all five-letter words over ten letters, where frontiers reach thousands of words within a
+few steps. Whatever the number of threads, the ladders must be exactly those of generate().
+*/
+
+TEST_CASE("Parallel Frontier Expansion") {
+	SECTION("Dense Synthetic Lexicon") {
+		auto engine = std::mt19937(6771);
+		auto coin = std::bernoulli_distribution(0.3);
+		auto lexicon = std::unordered_set<std::string>{};
+		auto word = std::string(5, 'a');
+		for (auto code = 0; code < 100000; ++code) {
+			auto rest = code;
+			for (auto& letter : word) {
+				letter = static_cast<char>('a' + rest % 10);
+				rest /= 10;
+			}
+			if (coin(engine)) {
+				lexicon.insert(word);
+			}
+		}
+		auto const graph = word_ladder::word_graph(lexicon);
+
+		auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+		std::sort(words.begin(), words.end());
+		auto pick = std::uniform_int_distribution<std::size_t>(0, words.size() - 1);
+		for (auto query = 0; query < 8; ++query) {
+			auto const& from = words[pick(engine)];
+			auto const& to = words[pick(engine)];
+			auto const expected = word_ladder::generate(from, to, graph);
+			for (auto const threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}}) {
+				CHECK(word_ladder::generate_parallel(from, to, graph, threads) == expected);
+			}
+		}
+	}
+
+	SECTION("English Lexicon") {
+		auto const graph = word_ladder::word_graph(word_ladder::read_lexicon("english.txt"));
+		auto const queries = std::vector<std::pair<std::string, std::string>>{
+		   {"atlases", "cabaret"},
+		   {"awake", "sleep"},
+		   {"airplane", "tricycle"},
+		   {"cat", "cat"},
+		   {"cat", "dogs"},
+		};
+		for (auto const& [from, to] : queries) {
+			CHECK(word_ladder::generate_parallel(from, to, graph, 4)
+			      == word_ladder::generate(from, to, graph));
+		}
+	}
+}
@@ -0,0 +1,93 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+rebuild_ladders() splices each intersecting prefix into every ladder that passes through the
+prefix's last word, until no new ladders appear. These tests check the splicing and deduplication
+on a small case worked out by hand, and on a hypercube whose every shortest ladder has to be
+rebuilt from single-word detours, which is slow if duplicates are found by comparing every pair of
+ladders.
+*/
+
+TEST_CASE("Rebuilding Ladders From Intersections") {
+	SECTION("Splices Prefixes And Drops Duplicates") {
+		auto ladder = std::vector<std::string>{"aaa", "aab", "abb", "bbb"};
+		auto intersections = std::vector<std::vector<std::string>>{
+		   {"aaa", "aba", "abb"},
+		   {"aaa", "baa", "bab", "bbb"},
+		   {"aaa", "aab", "bab"},
+		   {"aaa", "aab", "abb"},
+		};
+		auto const expected = std::vector<std::vector<std::string>>{
+		   {"aaa", "aab", "abb", "bbb"},
+		   {"aaa", "aab", "bab", "bbb"},
+		   {"aaa", "aba", "abb", "bbb"},
+		   {"aaa", "baa", "bab", "bbb"},
+		};
+		CHECK(word_ladder::rebuild_ladders(ladder, intersections) == expected);
+	}
+
+	SECTION("Rebuilds Every Ladder Across A Hypercube") {
+		// Words are a/b strings; flipping positions in index order gives one ladder to each word
+		auto constexpr positions = std::size_t{7};
+		auto const word_of = [](unsigned bits) {
+			auto word = std::string(positions, 'a');
+			for (auto i = std::size_t{0}; i < positions; ++i) {
+				if ((bits >> i) & 1U) {
+					word[i] = 'b';
+				}
+			}
+			return word;
+		};
+		auto const path_to = [&](unsigned bits) {
+			auto path = std::vector<std::string>{word_of(0)};
+			auto reached = 0U;
+			for (auto i = std::size_t{0}; i < positions; ++i) {
+				if ((bits >> i) & 1U) {
+					reached |= 1U << i;
+					path.push_back(word_of(reached));
+				}
+			}
+			return path;
+		};
+
+		// One prefix per edge of the cube: the ordered path to a word, then one more step
+		auto intersections = std::vector<std::vector<std::string>>{};
+		for (auto bits = 0U; bits < (1U << positions); ++bits) {
+			for (auto i = std::size_t{0}; i < positions; ++i) {
+				if (((bits >> i) & 1U) == 0) {
+					auto prefix = path_to(bits);
+					prefix.push_back(word_of(bits | (1U << i)));
+					intersections.push_back(std::move(prefix));
+				}
+			}
+		}
+		auto ladder = path_to((1U << positions) - 1);
+
+		auto const ladders = word_ladder::rebuild_ladders(ladder, intersections);
+		CHECK(ladders.size() == 5040);
+		CHECK(std::is_sorted(ladders.begin(), ladders.end()));
+		CHECK(std::adjacent_find(ladders.begin(), ladders.end()) == ladders.end());
+	}
+}
@@ -0,0 +1,135 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/result_cache.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+A result_cache sits in front of generate(). It must give the same answers whether or not they are
+cached, share one entry between a query and its reverse, tell lexicons apart, stay within its byte
+budget, and be safe to use from several threads (the last test is meant to be run under
+ThreadSanitizer too).
+*/
+
+TEST_CASE("Result Cache") {
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+
+	SECTION("Cached Answers Match generate()") {
+		auto cache = word_ladder::result_cache(std::size_t{1} << 24);
+		for (auto round = 0; round < 2; ++round) {
+			CHECK(cache.generate("awake", "sleep", english_lexicon)
+			      == word_ladder::generate("awake", "sleep", english_lexicon));
+			CHECK(cache.generate("atlases", "cabaret", english_lexicon)
+			      == word_ladder::generate("atlases", "cabaret", english_lexicon));
+			CHECK(cache.generate("airplane", "tricycle", english_lexicon).empty());
+		}
+		auto const stats = cache.stats();
+		CHECK(stats.misses == 3);
+		CHECK(stats.hits == 3);
+		CHECK(stats.entries == 3);
+	}
+
+	SECTION("A Query And Its Reverse Share An Entry") {
+		auto cache = word_ladder::result_cache(std::size_t{1} << 24);
+		CHECK(cache.generate("sleep", "awake", english_lexicon)
+		      == word_ladder::generate("sleep", "awake", english_lexicon));
+		CHECK(cache.generate("awake", "sleep", english_lexicon)
+		      == word_ladder::generate("awake", "sleep", english_lexicon));
+		CHECK(cache.generate("cabaret", "atlases", english_lexicon)
+		      == word_ladder::generate("cabaret", "atlases", english_lexicon));
+		CHECK(cache.stats().misses == 2);
+		CHECK(cache.stats().hits == 1);
+	}
+
+	SECTION("Lexicons Are Told Apart, But Copies Are Not") {
+		auto cache = word_ladder::result_cache(std::size_t{1} << 24);
+		auto const small_lexicon = word_ladder::load_lexicon("OnePathSuccess.txt");
+		auto const copy = small_lexicon;
+		CHECK(cache.generate("aaa", "zzz", small_lexicon).size() == 1);
+		CHECK(cache.generate("aaa", "zzz", copy).size() == 1);
+		CHECK(cache.stats().hits == 1);
+
+		auto const other = word_ladder::load_lexicon("OnePathSuccess.txt");
+		CHECK(cache.generate("aaa", "zzz", other).size() == 1);
+		CHECK(cache.stats().misses == 2);
+	}
+
+	SECTION("Words Outside The Lexicon Are Not Cached") {
+		auto cache = word_ladder::result_cache(std::size_t{1} << 24);
+		CHECK(cache.generate("work", "zzzz", english_lexicon).empty());
+		CHECK(cache.generate("work", "work", english_lexicon)
+		      == std::vector<std::vector<std::string>>{{"work"}});
+		CHECK(cache.stats().hits + cache.stats().misses == 0);
+	}
+
+	SECTION("The Byte Budget Is Kept") {
+		auto probe = word_ladder::result_cache(std::size_t{1} << 24);
+		(void)probe.generate("awake", "sleep", english_lexicon);
+		auto const entry_bytes = probe.stats().bytes;
+
+		auto cache = word_ladder::result_cache(entry_bytes);
+		(void)cache.generate("awake", "sleep", english_lexicon);
+		(void)cache.generate("atlases", "cabaret", english_lexicon);
+		(void)cache.generate("awake", "sleep", english_lexicon);
+		CHECK(cache.stats().bytes <= entry_bytes);
+		CHECK(cache.stats().entries == 1);
+		CHECK(cache.stats().hits == 1);
+	}
+}
+
+TEST_CASE("Result Cache Shared Between Threads") {
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"awake", "sleep"},
+	   {"sleep", "awake"},
+	   {"work", "play"},
+	   {"play", "work"},
+	   {"cold", "warm"},
+	};
+	auto expected = std::vector<std::vector<std::vector<std::string>>>{};
+	for (auto const& [from, to] : queries) {
+		expected.push_back(word_ladder::generate(from, to, english_lexicon));
+	}
+
+	// A small budget, so that threads evict each other's entries as well as share them
+	auto cache = word_ladder::result_cache(4096);
+	auto constexpr threads = std::size_t{8};
+	auto mismatches = std::vector<int>(threads);
+	{
+		auto workers = std::vector<std::jthread>{};
+		for (auto thread = std::size_t{0}; thread < threads; ++thread) {
+			workers.emplace_back([&, thread] {
+				for (auto i = std::size_t{0}; i < 4 * queries.size(); ++i) {
+					auto const query = (i + thread) % queries.size();
+					auto const& [from, to] = queries[query];
+					if (cache.generate(from, to, english_lexicon) != expected[query]) {
+						++mismatches[thread];
+					}
+				}
+			});
+		}
+	}
+	CHECK(mismatches == std::vector<int>(threads));
+	CHECK(cache.stats().hits + cache.stats().misses == 4 * threads * queries.size());
+}
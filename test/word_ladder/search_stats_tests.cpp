@@ -0,0 +1,128 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+Asking generate() for search_stats must not change its answer. The counts must be consistent with
+each other and with the query, and a second query must add to the first.
+*/
+
+TEST_CASE("Search Statistics") {
+	auto const english_set = word_ladder::read_lexicon("english.txt");
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const english_index = word_ladder::neighbor_index(english_lexicon);
+
+	SECTION("Probing Engines") {
+		auto stats = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("awake", "sleep", english_set, nullptr, &stats)
+		      == word_ladder::generate("awake", "sleep", english_set));
+		CHECK(stats.layers >= 2);
+		CHECK(stats.dequeued >= stats.layers);
+		CHECK(stats.peak_frontier > 0);
+		CHECK(stats.peak_frontier <= stats.dequeued);
+		CHECK(stats.hits > 0);
+		CHECK(stats.hits <= stats.candidates);
+		CHECK(stats.probes >= stats.candidates + stats.hits);
+		CHECK(stats.intersections >= 2);
+		CHECK(stats.search_time.count() > 0);
+
+		// The set and the partitioned lexicon hold the same words, so they search the same way
+		auto lexicon_stats = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("awake", "sleep", english_lexicon, nullptr, &lexicon_stats)
+		      == word_ladder::generate("awake", "sleep", english_lexicon));
+		CHECK(lexicon_stats.dequeued == stats.dequeued);
+		CHECK(lexicon_stats.hits == stats.hits);
+		CHECK(lexicon_stats.intersections == stats.intersections);
+	}
+
+	SECTION("Index Finds Neighbours Without Probing The Lexicon") {
+		auto probing = word_ladder::search_stats{};
+		auto indexed = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("atlases", "cabaret", english_lexicon, nullptr, &probing).size()
+		      == 840);
+		CHECK(word_ladder::generate("atlases", "cabaret", english_index, nullptr, &indexed).size()
+		      == 840);
+		CHECK(indexed.candidates == indexed.hits);
+		CHECK(indexed.hits == probing.hits);
+		CHECK(indexed.probes < probing.probes);
+		CHECK(indexed.layers == probing.layers);
+	}
+
+	SECTION("Exact Counts On A Tiny Lexicon") {
+		// cat expands to cot, cot to cat and cog, and cog to cot and dog, which meets the back
+		// frontier: five steps, each looked up once. The probing engines also try the five other
+		// letters of {a, c, d, g, o, t} at each of three positions of the three words expanded.
+		auto const tiny = std::unordered_set<std::string>{"cat", "cot", "cog", "dog"};
+		auto const ladder = std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}};
+
+		auto indexed = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("cat", "dog", word_ladder::neighbor_index(tiny), nullptr, &indexed)
+		      == ladder);
+		CHECK(indexed.dequeued == 3);
+		CHECK(indexed.candidates == 5);
+		CHECK(indexed.probes == 5);
+
+		auto probing = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("cat", "dog", tiny, nullptr, &probing) == ladder);
+		CHECK(probing.dequeued == 3);
+		CHECK(probing.candidates == 45);
+		CHECK(probing.hits == 5);
+		CHECK(probing.probes == 45 + 5);
+	}
+
+	SECTION("Counts Add Up Across Queries") {
+		auto once = word_ladder::search_stats{};
+		auto twice = word_ladder::search_stats{};
+		(void)word_ladder::generate("work", "play", english_index, nullptr, &once);
+		(void)word_ladder::generate("work", "play", english_index, nullptr, &twice);
+		(void)word_ladder::generate("work", "play", english_index, nullptr, &twice);
+		CHECK(twice.dequeued == 2 * once.dequeued);
+		CHECK(twice.probes == 2 * once.probes);
+		CHECK(twice.layers == 2 * once.layers);
+		CHECK(twice.peak_frontier == once.peak_frontier);
+	}
+
+	SECTION("Failing Query") {
+		auto stats = word_ladder::search_stats{};
+		CHECK(word_ladder::generate("airplane", "tricycle", english_lexicon, nullptr, &stats).empty());
+		CHECK(stats.intersections == 0);
+		CHECK(stats.rebuild_time.count() == 0);
+		CHECK(stats.sort_time.count() == 0);
+	}
+
+	SECTION("Rebuilding From A Parent Map") {
+		auto const parents = std::unordered_map<std::string, std::vector<std::string>>{
+		   {"cat", {}},
+		   {"cot", {"cat"}},
+		   {"cog", {"cot"}},
+		   {"dog", {"cog"}},
+		};
+		auto stats = word_ladder::search_stats{};
+		CHECK(word_ladder::rebuild_ladders("cat", "dog", parents, &stats)
+		      == std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}});
+		CHECK(stats.rebuild_time.count() > 0);
+		CHECK(stats.dequeued == 0);
+	}
+}
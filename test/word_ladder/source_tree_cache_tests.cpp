@@ -0,0 +1,112 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/source_tree_cache.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+A source_tree_cache keeps one breadth-first search tree per source word and answers every later
+query from that word by walking its tree. Answers must match generate() whether they come from a
+fresh tree or a cached one, and the counters must show which it was. The byte budget must be
+respected by evicting the least recently used tree.
+*/
+
+namespace {
+	// Built once and shared by every section
+	auto english_graph() -> word_ladder::word_graph const& {
+		static auto const graph = word_ladder::word_graph(word_ladder::read_lexicon("english.txt"));
+		return graph;
+	}
+} // namespace
+
+TEST_CASE("Source Tree Cache") {
+	auto const& graph = english_graph();
+	auto const queries = std::vector<std::pair<std::string, std::string>>{
+	   {"work", "play"},
+	   {"work", "cold"},
+	   {"work", "zzzz"},
+	   {"awake", "sleep"},
+	   {"awake", "atlas"},
+	   {"work", "warm"},
+	   {"awake", "awake"},
+	   {"atlases", "cabaret"},
+	   {"airplane", "tricycle"},
+	};
+
+	SECTION("Answers Match generate()") {
+		auto cache = word_ladder::source_tree_cache(graph, std::size_t{1} << 24);
+		for (auto const& [from, to] : queries) {
+			CHECK(cache.generate(from, to) == word_ladder::generate(from, to, graph));
+		}
+
+		// One miss per distinct source: work, awake and atlases. Unknown words, one-word ladders
+		// and words in different components never reach the cache.
+		auto const stats = cache.stats();
+		CHECK(stats.misses == 3);
+		CHECK(stats.hits == 3);
+		CHECK(stats.entries == 3);
+		CHECK(stats.evictions == 0);
+		CHECK(stats.bytes > 0);
+	}
+
+	SECTION("Least Recently Used Trees Are Evicted To Stay In Budget") {
+		// Find how big one tree of each length is, then allow room for just two four-letter ones
+		auto probe = word_ladder::source_tree_cache(graph, std::size_t{1} << 24);
+		(void)probe.generate("work", "play");
+		auto const four_letter_tree = probe.stats().bytes;
+
+		auto cache = word_ladder::source_tree_cache(graph, 2 * four_letter_tree + 8);
+		(void)cache.generate("work", "play");
+		(void)cache.generate("cold", "warm");
+		(void)cache.generate("work", "cold");
+		(void)cache.generate("play", "work");
+		auto stats = cache.stats();
+		CHECK(stats.entries == 2);
+		CHECK(stats.evictions == 1);
+		CHECK(stats.bytes <= 2 * four_letter_tree + 8);
+
+		// "cold" was the least recently used, so it is the one that went
+		CHECK(cache.generate("work", "warm") == word_ladder::generate("work", "warm", graph));
+		CHECK(cache.stats().hits == stats.hits + 1);
+		CHECK(cache.generate("cold", "play") == word_ladder::generate("cold", "play", graph));
+		CHECK(cache.stats().misses == stats.misses + 1);
+	}
+
+	SECTION("Trees Bigger Than The Budget Are Not Kept") {
+		auto cache = word_ladder::source_tree_cache(graph, 16);
+		CHECK(cache.generate("work", "play") == word_ladder::generate("work", "play", graph));
+		CHECK(cache.generate("work", "play") == word_ladder::generate("work", "play", graph));
+		CHECK(cache.stats().misses == 2);
+		CHECK(cache.stats().entries == 0);
+	}
+
+	SECTION("Clearing Empties The Cache") {
+		auto cache = word_ladder::source_tree_cache(graph, std::size_t{1} << 24);
+		(void)cache.generate("work", "play");
+		cache.clear();
+		CHECK(cache.stats().entries == 0);
+		CHECK(cache.stats().bytes == 0);
+		(void)cache.generate("work", "play");
+		CHECK(cache.stats().misses == 2);
+	}
+}
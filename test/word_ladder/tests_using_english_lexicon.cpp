@@ -68,6 +68,18 @@ TEST_CASE("Testing Known Results From English Lexicon") {
 		      == 1);
 	}
 
+	SECTION("sleep -> awake is awake -> sleep reversed") {
+		auto const ladders = word_ladder::generate("awake", "sleep", english_lexicon);
+		auto reversed = word_ladder::generate("sleep", "awake", english_lexicon);
+
+		CHECK(std::is_sorted(reversed.begin(), reversed.end()));
+		std::for_each(reversed.begin(), reversed.end(), [](auto& ladder) {
+			std::reverse(ladder.begin(), ladder.end());
+		});
+		std::sort(reversed.begin(), reversed.end());
+		CHECK(reversed == ladders);
+	}
+
 	SECTION("work -> play") {
 		auto const ladders = word_ladder::generate("work", "play", english_lexicon);
 
@@ -0,0 +1,240 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/word_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+The word graph replaces string hashing with integer ids, so these tests check that ids follow the
+sorted order of the words they stand for, that the adjacency lists hold exactly the one-letter
+steps, and that searching the graph gives the same ladders as searching the lexicon. A search's
+distances are stamped rather than cleared, so those must read as unreached in the next search.
+*/
+
+TEST_CASE("Word Graph Structure") {
+	auto const lexicon = word_ladder::read_lexicon("OnePathSuccess.txt");
+	auto const graph = word_ladder::word_graph(lexicon);
+
+	auto const* const words = graph.words_of_length(3);
+	REQUIRE(words != nullptr);
+	CHECK(words->length() == 3);
+	CHECK(words->size() == 11);
+	CHECK(graph.words_of_length(2) == nullptr);
+	CHECK(graph.words_of_length(4) == nullptr);
+
+	SECTION("Ids Follow Sorted Order") {
+		for (auto id = word_ladder::word_graph::word_id{1}; id < words->size(); ++id) {
+			CHECK(words->word(id - 1) < words->word(id));
+		}
+		CHECK(words->find("aaa") == 0);
+		CHECK(words->find("zzz") == 10);
+		CHECK(!words->find("zza").has_value());
+	}
+
+	SECTION("Neighbours Are The One-Letter Steps") {
+		auto const neighbours = words->neighbors(*words->find("aaa"));
+		auto names = std::vector<std::string_view>{};
+		std::transform(neighbours.begin(), neighbours.end(), std::back_inserter(names), [&](auto id) {
+			return words->word(id);
+		});
+
+		CHECK(std::is_sorted(neighbours.begin(), neighbours.end()));
+		CHECK(names == std::vector<std::string_view>{"aas", "aaz", "baa", "caa"});
+	}
+
+	SECTION("Words With A Ladder Between Them Share A Component") {
+		for (auto id = word_ladder::word_graph::word_id{0}; id < words->size(); ++id) {
+			for (auto const next : words->neighbors(id)) {
+				CHECK(words->component(id) == words->component(next));
+			}
+		}
+		CHECK(words->connected(*words->find("aaa"), *words->find("zzz")));
+
+		auto const apart = word_ladder::word_graph(word_ladder::read_lexicon("MultipleHopsFailure.txt"));
+		auto const* const three = apart.words_of_length(3);
+		REQUIRE(three != nullptr);
+		CHECK(three->connected(*three->find("aaa"), *three->find("bbb")));
+		CHECK(!three->connected(*three->find("aaa"), *three->find("zzz")));
+		CHECK(three->component(*three->find("zzz")) == *three->find("zzz"));
+	}
+}
+
+TEST_CASE("Graph Search Matches Lexicon Search") {
+	SECTION("Purpose-Built Lexicons") {
+		auto const queries = std::vector<std::pair<std::string, std::pair<std::string, std::string>>>{
+		   {"Empty.txt", {"a", "z"}},
+		   {"MultipleHopsFailure.txt", {"aaa", "zzz"}},
+		   {"OnePathSuccess.txt", {"aaa", "zzz"}},
+		   {"NoLoops.txt", {"aaaaa", "bbbaa"}},
+		   {"BasicMultiplePathsSuccess.txt", {"aaa", "acb"}},
+		   {"MultiplesPathsWithDoubleUps.txt", {"aaaaaa", "zzaaaz"}},
+		   {"BasicEmbeddedDubUps.txt", {"aaaaaa", "zaaazz"}},
+		   {"ComplexCollidingPaths.txt", {"GOAL", "QUIZ"}},
+		};
+		for (auto const& [file, query] : queries) {
+			auto const lexicon = word_ladder::read_lexicon(file);
+			auto const graph = word_ladder::word_graph(lexicon);
+			CHECK(word_ladder::generate(query.first, query.second, graph)
+			      == word_ladder::generate(query.first, query.second, lexicon));
+		}
+	}
+
+	SECTION("English Lexicon") {
+		auto const english_lexicon = word_ladder::read_lexicon("english.txt");
+		auto const graph = word_ladder::word_graph(english_lexicon);
+
+		auto const ladders = word_ladder::generate("atlases", "cabaret", graph);
+		CHECK(std::size(ladders) == 840);
+		CHECK(std::is_sorted(ladders.begin(), ladders.end()));
+
+		auto const queries = std::vector<std::pair<std::string, std::string>>{
+		   {"awake", "sleep"},
+		   {"sleep", "awake"},
+		   {"work", "play"},
+		   {"airplane", "tricycle"},
+		   {"cat", "cat"},
+		   {"cat", "dogs"},
+		};
+		for (auto const& [from, to] : queries) {
+			CHECK(word_ladder::generate(from, to, graph)
+			      == word_ladder::generate(from, to, english_lexicon));
+		}
+	}
+}
+
+TEST_CASE("Stamped Search Distances") {
+	auto distances = word_ladder::search_distances{};
+	distances.reset(4);
+	distances.set(1, 3);
+	CHECK(distances[1] == 3);
+	CHECK(distances[2] == word_ladder::search_distances::unreached);
+
+	distances.reset(4);
+	CHECK(distances[1] == word_ladder::search_distances::unreached);
+	distances.set(2, 0);
+	CHECK(distances[2] == 0);
+
+	distances.reset(6);
+	CHECK(distances[2] == word_ladder::search_distances::unreached);
+	CHECK(distances[5] == word_ladder::search_distances::unreached);
+}
+
+TEST_CASE("Word Graph Snapshots") {
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const graph = word_ladder::word_graph(english_lexicon);
+	word_ladder::save_word_graph(graph, "english.wlg");
+
+	SECTION("Mapped Snapshot Answers Like The Graph It Was Saved From") {
+		auto const mapped = word_ladder::map_word_graph("english.wlg");
+
+		for (auto length = std::size_t{1}; length <= english_lexicon.max_length(); ++length) {
+			auto const* const built = graph.words_of_length(length);
+			auto const* const loaded = mapped.words_of_length(length);
+			REQUIRE((built == nullptr) == (loaded == nullptr));
+			if (built != nullptr) {
+				CHECK(built->size() == loaded->size());
+				CHECK(built->word(0) == loaded->word(0));
+				auto const last = static_cast<word_ladder::word_graph::word_id>(built->size() - 1);
+				CHECK(built->component(last) == loaded->component(last));
+			}
+		}
+
+		CHECK(std::size(word_ladder::generate("atlases", "cabaret", mapped)) == 840);
+		CHECK(word_ladder::generate("work", "play", mapped)
+		      == word_ladder::generate("work", "play", graph));
+		CHECK(word_ladder::generate("airplane", "tricycle", mapped).empty());
+		auto const* const eight = mapped.words_of_length(8);
+		CHECK(!eight->connected(*eight->find("airplane"), *eight->find("tricycle")));
+	}
+
+	SECTION("Mapped Snapshot Outlives Its First Owner") {
+		auto copy = word_ladder::word_graph{};
+		{
+			auto const mapped = word_ladder::map_word_graph("english.wlg");
+			copy = mapped;
+		}
+		CHECK(std::size(word_ladder::generate("awake", "sleep", copy)) == 2);
+	}
+
+	SECTION("Files That Are Not Snapshots Are Rejected") {
+		CHECK_THROWS_AS(word_ladder::map_word_graph("Empty.txt"), std::runtime_error);
+		CHECK_THROWS_AS(word_ladder::map_word_graph("english.txt"), std::runtime_error);
+		CHECK_THROWS_AS(word_ladder::map_word_graph("NoSuchFile.wlg"), std::runtime_error);
+
+		// Each case damages a copy of a saved snapshot. The table entry for the 3-letter words
+		// follows a 24-byte header and three 48-byte entries; its words' offset is its third field,
+		// its offsets' the fourth and its neighbours' the fifth.
+		auto const saved = [] {
+			auto in = std::ifstream("english.wlg", std::ios::binary);
+			return std::vector<char>(std::istreambuf_iterator<char>(in),
+			                         std::istreambuf_iterator<char>());
+		}();
+		auto const field = [&saved](std::size_t i) {
+			auto value = std::uint64_t{0};
+			std::memcpy(&value, saved.data() + 24 + 3 * 48 + 8 * i, sizeof(value));
+			return value;
+		};
+		auto const maps = [](std::vector<char> const& bytes) {
+			{
+				auto out = std::ofstream("corrupt.wlg", std::ios::binary);
+				out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+			}
+			return word_ladder::map_word_graph("corrupt.wlg");
+		};
+
+		// A neighbour id past the end of its length
+		auto bad_neighbor = saved;
+		auto const bad_id = std::uint32_t{1000000};
+		std::memcpy(bad_neighbor.data() + field(4), &bad_id, sizeof(bad_id));
+		CHECK_THROWS_WITH(maps(bad_neighbor), "Corrupt word graph snapshot.");
+
+		// Offsets that start one byte into their section, so they can't be read as integers
+		auto misaligned = saved;
+		auto const shifted = field(3) + 1;
+		std::memcpy(misaligned.data() + 24 + 3 * 48 + 8 * 3, &shifted, sizeof(shifted));
+		CHECK_THROWS_WITH(maps(misaligned), "Corrupt word graph snapshot.");
+
+		// The first two 3-letter words swapped, so they are no longer sorted
+		auto unsorted = saved;
+		std::swap_ranges(unsorted.begin() + static_cast<std::ptrdiff_t>(field(2)),
+		                 unsorted.begin() + static_cast<std::ptrdiff_t>(field(2) + 3),
+		                 unsorted.begin() + static_cast<std::ptrdiff_t>(field(2) + 3));
+		CHECK_THROWS_WITH(maps(unsorted), "Corrupt word graph snapshot.");
+
+		// And the same word twice
+		auto repeated = saved;
+		std::copy_n(repeated.begin() + static_cast<std::ptrdiff_t>(field(2)),
+		            3,
+		            repeated.begin() + static_cast<std::ptrdiff_t>(field(2) + 3));
+		CHECK_THROWS_WITH(maps(repeated), "Corrupt word graph snapshot.");
+
+		CHECK(std::size(word_ladder::generate("awake", "sleep", maps(saved))) == 2);
+	}
+}
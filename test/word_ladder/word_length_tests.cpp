@@ -0,0 +1,72 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+The set and lexicon overloads probe for each step in the words of the query's length. Every
+length must give the same ladders as the neighbour index, which finds steps without probing.
+*/
+
+TEST_CASE("Searches Of Every Length") {
+	auto const english_set = word_ladder::read_lexicon("english.txt");
+	auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+	auto const index = word_ladder::neighbor_index(english_lexicon);
+
+	SECTION("Every Length Matches The Index") {
+		for (auto length = std::size_t{1}; length <= english_lexicon.max_length(); ++length) {
+			auto const& words = english_lexicon.words_of_length(length);
+			auto sorted = std::vector<std::string>(words.begin(), words.end());
+			std::sort(sorted.begin(), sorted.end());
+			for (auto i = std::size_t{0}; i + 1 < sorted.size() and i < 40; i += 13) {
+				auto const& from = sorted[i];
+				auto const& to = sorted[(i * 7 + 1) % sorted.size()];
+				auto const expected = word_ladder::generate(from, to, index);
+				CHECK(word_ladder::generate(from, to, english_set) == expected);
+				CHECK(word_ladder::generate(from, to, english_lexicon) == expected);
+			}
+		}
+	}
+
+	SECTION("Mismatched And Missing Words") {
+		CHECK(word_ladder::generate("cat", "dogs", english_set).empty());
+		CHECK(word_ladder::generate("cat", "zzz", english_lexicon).empty());
+		CHECK(word_ladder::generate("zzz", "cat", english_lexicon).empty());
+		CHECK(word_ladder::generate("cat", "cat", english_set)
+		      == std::vector<std::vector<std::string>>{{"cat"}});
+	}
+
+	SECTION("Long Words") {
+		auto const long_words = std::unordered_set<std::string>{
+		   "aaaaaaaaaaaaaaaaa",
+		   "aaaaaaaaaaaaaaaab",
+		   "aaaaaaaaaaaaaaabb",
+		   "aaaaaaaaaaaaaaaaaa",
+		};
+		CHECK(word_ladder::generate("aaaaaaaaaaaaaaaaa", "aaaaaaaaaaaaaaabb", long_words)
+		      == std::vector<std::vector<std::string>>{
+		         {"aaaaaaaaaaaaaaaaa", "aaaaaaaaaaaaaaaab", "aaaaaaaaaaaaaaabb"}});
+	}
+}
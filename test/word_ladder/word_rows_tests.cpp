@@ -0,0 +1,109 @@
+//
+//  Copyright UNSW Sydney School of Computer Science and Engineering
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <comp6771/lexicon.hpp>
+#include <comp6771/neighbor_index.hpp>
+#include <comp6771/word_ladder.hpp>
+#include <comp6771/word_rows.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+/*
+word_rows finds neighbours by comparing whole rows at once. It must find exactly the neighbours a
+neighbor_index finds, at every word length (rows of one, two and several vector registers, and
+rows too wide for the vector path), and generate() over it must match the other engines.
+*/
+
+namespace {
+	template<typename Neighbors>
+	auto neighbors_of(Neighbors const& words, std::string_view word) -> std::vector<std::string> {
+		auto result = std::vector<std::string>{};
+		words.for_each_neighbor(word, [&result](std::string_view next) { result.emplace_back(next); });
+		return result;
+	}
+
+	// The index yields neighbours one letter position at a time; rows yield them in sorted order
+	auto sorted_neighbors_of(word_ladder::neighbor_index const& index, std::string_view word)
+	   -> std::vector<std::string> {
+		auto result = neighbors_of(index, word);
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+} // namespace
+
+TEST_CASE("Word Rows") {
+	SECTION("Same Neighbours As The Index") {
+		auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+		auto const index = word_ladder::neighbor_index(english_lexicon);
+		auto const rows = word_ladder::word_rows(english_lexicon);
+		for (auto length = std::size_t{1}; length <= english_lexicon.max_length(); ++length) {
+			auto n = std::size_t{0};
+			for (auto const word : english_lexicon.words_of_length(length)) {
+				// Every word of the rarer lengths, and a spread of the common ones
+				if (n++ % 97 == 0 or length > 12) {
+					CHECK(rows.contains(word));
+					CHECK(rows.find(word) == index.find(word));
+					CHECK(neighbors_of(rows, word) == sorted_neighbors_of(index, word));
+				}
+			}
+		}
+		CHECK(neighbors_of(rows, "zzzzz") == sorted_neighbors_of(index, "zzzzz"));
+		CHECK(!rows.contains("zzzzz"));
+		CHECK(rows.word_count(5) == index.word_count(5));
+		CHECK(neighbors_of(rows, std::string(100, 'a')).empty());
+	}
+
+	SECTION("Wide Rows") {
+		auto const long_words = std::unordered_set<std::string>{
+		   std::string(20, 'a'),
+		   std::string(19, 'a') + 'b',
+		   'b' + std::string(19, 'a'),
+		   std::string(40, 'a'),
+		   std::string(20, 'a') + 'c' + std::string(19, 'a'),
+		   std::string(20, 'a') + "cc" + std::string(18, 'a'),
+		   std::string(70, 'a'),
+		   std::string(69, 'a') + 'd',
+		   std::string(68, 'a') + "dd",
+		};
+		auto const rows = word_ladder::word_rows(long_words);
+		CHECK(neighbors_of(rows, std::string(20, 'a'))
+		      == std::vector<std::string>{std::string(19, 'a') + 'b', 'b' + std::string(19, 'a')});
+		CHECK(neighbors_of(rows, std::string(40, 'a'))
+		      == std::vector<std::string>{std::string(20, 'a') + 'c' + std::string(19, 'a')});
+		CHECK(neighbors_of(rows, std::string(70, 'a'))
+		      == std::vector<std::string>{std::string(69, 'a') + 'd'});
+		CHECK(rows.contains(std::string(68, 'a') + "dd"));
+	}
+
+	SECTION("Ladders Match The Other Engines") {
+		auto const english_lexicon = word_ladder::load_lexicon("english.txt");
+		auto const rows = word_ladder::word_rows(english_lexicon);
+		CHECK(word_ladder::generate("awake", "sleep", rows)
+		      == word_ladder::generate("awake", "sleep", english_lexicon));
+		CHECK(word_ladder::generate("work", "play", rows)
+		      == word_ladder::generate("work", "play", english_lexicon));
+		CHECK(word_ladder::generate("atlases", "cabaret", rows).size() == 840);
+		CHECK(word_ladder::generate("airplane", "tricycle", rows).empty());
+		CHECK(word_ladder::generate("cat", "cat", rows)
+		      == std::vector<std::vector<std::string>>{{"cat"}});
+	}
+}